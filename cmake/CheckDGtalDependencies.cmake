@@ -46,3 +46,11 @@ if (UNIX AND NOT APPLE)
   target_link_libraries(DGtal PUBLIC rt)
   set(DGtalLibDependencies ${DGtalLibDependencies} -lrt)
 endif()
+
+# -----------------------------------------------------------------------------
+# Looking for the system thread library (used by DGtal::ThreadPool)
+# -----------------------------------------------------------------------------
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+target_link_libraries(DGtal PUBLIC Threads::Threads)
+set(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
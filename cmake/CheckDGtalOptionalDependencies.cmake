@@ -480,7 +480,7 @@ if(WITH_FFTW3)
   if(FFTW3_FOUND)
     set(FFTW3_FOUND_DGTAL 1)
     target_compile_definitions(DGtal PUBLIC -DWITH_FFTW3)
-    target_include_directories(DGtal PUBLIC ${FFTW3_INCLUDES})
+    target_include_directories(DGtal PUBLIC ${FFTW3_INCLUDE_DIR})
     target_link_libraries(DGtal PUBLIC ${FFTW3_LIBRARIES} ${FFTW3_DEP_LIBRARIES})
     set(DGtalLibDependencies ${DGtalLibDependencies} ${FFTW3_LIBRARIES} ${FFTW3_DEP_LIBRARIES})
     message(STATUS "FFTW3 is found : ${FFTW3_LIBRARIES}.")
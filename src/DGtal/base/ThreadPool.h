@@ -0,0 +1,254 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ThreadPool.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ThreadPool.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testThreadPool.cpp
+ */
+
+#if defined(ThreadPool_RECURSES)
+#error Recursive header files inclusion detected in ThreadPool.h
+#else // defined(ThreadPool_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ThreadPool_RECURSES
+
+#if !defined ThreadPool_h
+/** Prevents repeated inclusion of headers. */
+#define ThreadPool_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ThreadPool
+  /**
+   * Description of class 'ThreadPool' <p>
+   * \brief Aim: A fixed-size pool of worker threads executing
+   * "parallel for" loops over a range of independent tasks.
+   *
+   * Contrary to the OpenMP loops (only available when DGtal is built
+   * with the WITH_OPENMP flag), this pool relies on the C++11 thread
+   * library and can thus be selected at runtime by any algorithm
+   * accepting it (e.g. VoronoiMap). Worker threads are created once
+   * in the constructor and are reused by successive calls to
+   * parallelFor(), so that short parallel loops do not pay the
+   * thread creation cost.
+   *
+   * Tasks are identified by an index in [0, nbTasks) and are
+   * dynamically dispatched to the threads (the calling thread also
+   * processes tasks). If a task throws, remaining tasks are skipped
+   * and the first exception is rethrown in the calling thread.
+   * Calling parallelFor() from inside a task of the same pool
+   * executes the nested loop sequentially.
+   *
+   * @code
+   * ThreadPool pool;   // as many threads as hardware threads
+   * std::vector<double> v( 1000 );
+   * pool.parallelFor( v.size(), [&] ( std::size_t i ) { v[ i ] = std::sqrt( i ); } );
+   * @endcode
+   *
+   * @see testThreadPool.cpp
+   */
+  class ThreadPool
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param nbThreads the number of threads used by parallel loops,
+     * including the calling thread. If 0, the number of hardware
+     * threads is used. A value of 1 makes all loops sequential.
+     */
+    explicit ThreadPool( unsigned int nbThreads = 0 );
+
+    /**
+     * Destructor. Joins the worker threads.
+     */
+    ~ThreadPool();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ThreadPool( const ThreadPool & other ) = delete;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ThreadPool & operator=( const ThreadPool & other ) = delete;
+
+    // ----------------------- Parallel services ------------------------------
+  public:
+
+    /**
+     * @return the number of threads running the tasks (including
+     * the calling thread).
+     */
+    unsigned int size() const;
+
+    /**
+     * Runs @a aFunction on each task index in [0, @a nbTasks) and
+     * waits for the completion of all tasks.
+     *
+     * @tparam TFunction a callable with signature void( std::size_t ).
+     * @param nbTasks the number of tasks.
+     * @param aFunction the function to call on each task index.
+     */
+    template <typename TFunction>
+    void parallelFor( std::size_t nbTasks, TFunction && aFunction );
+
+    /**
+     * Runs @a aFunction on each task index in [0, @a nbTasks) and
+     * waits for the completion of all tasks. The function also gets
+     * the rank in [0, size()) of the thread running the task, which
+     * can be used to index per-thread buffers.
+     *
+     * @tparam TFunction a callable with signature void( std::size_t, unsigned int ).
+     * @param nbTasks the number of tasks.
+     * @param aFunction the function to call on each (task index, thread rank).
+     */
+    template <typename TFunction>
+    void parallelForWithRank( std::size_t nbTasks, TFunction && aFunction );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Type of the job run by the threads (task index, thread rank).
+    typedef std::function< void( std::size_t, unsigned int ) > Job;
+
+    /// Worker threads (size() - 1 of them).
+    std::vector< std::thread > myWorkers;
+    /// Serializes concurrent calls to parallelFor from different threads.
+    std::mutex mySubmitMutex;
+    /// Protects the job description below.
+    std::mutex myMutex;
+    /// Signals workers that a new job is available (or that the pool stops).
+    std::condition_variable myJobAvailable;
+    /// Signals the caller that all workers are done with the job.
+    std::condition_variable myJobDone;
+    /// Current job.
+    Job myJob;
+    /// Number of tasks of the current job.
+    std::size_t myNbTasks;
+    /// Next task index to process.
+    std::atomic< std::size_t > myNextTask;
+    /// Number of workers still processing the current job.
+    unsigned int myNbRunning;
+    /// Job counter, used by workers to detect new jobs.
+    std::size_t myGeneration;
+    /// When true, workers exit.
+    bool myStop;
+    /// First exception thrown by a task of the current job.
+    std::exception_ptr myException;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Main loop of the worker threads.
+     * @param rank the rank of the worker (in [1, size()) ).
+     */
+    void workerLoop( unsigned int rank );
+
+    /**
+     * Processes tasks of the current job until none remains.
+     * @param rank the rank of the calling thread.
+     */
+    void runTasks( unsigned int rank );
+
+    /**
+     * Dispatches a job to the pool and waits for its completion.
+     * @param nbTasks the number of tasks.
+     * @param aJob the job.
+     */
+    void run( std::size_t nbTasks, const Job & aJob );
+
+    /**
+     * @return a reference to the thread-local pointer to the pool the
+     * current thread is working for (nullptr if none).
+     */
+    static const ThreadPool * & currentPool();
+
+  }; // end of class ThreadPool
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ThreadPool'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ThreadPool' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const ThreadPool & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ThreadPool.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ThreadPool_h
+
+#undef ThreadPool_RECURSES
+#endif // else defined(ThreadPool_RECURSES)
@@ -0,0 +1,348 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantFFTEstimator.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IntegralInvariantFFTEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantFFTEstimator_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantFFTEstimator.h
+#else // defined(IntegralInvariantFFTEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantFFTEstimator_RECURSES
+
+#if !defined IntegralInvariantFFTEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantFFTEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/math/RealFFT.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class IntegralInvariantFFTEstimator
+/**
+* Description of template class 'IntegralInvariantFFTEstimator' <p>
+* \brief Aim: This class implements an Integral Invariant estimator
+* whose volume and covariance moments are computed by convolving
+* the whole shape with the ball kernel using Fast Fourier Transforms.
+*
+* IntegralInvariantVolumeEstimator and
+* IntegralInvariantCovarianceEstimator count the kernel points
+* inside the shape at each surfel, with incremental masks between
+* adjacent surfels. Their cost per surfel grows as O(r^{d-1}). Here,
+* each moment (1 for the volume, 1 + d + d(d+1)/2 for the covariance
+* matrix) is convolved once with the characteristic function of the
+* shape, in O(N log N) for a domain of N points whatever the radius,
+* and is then sampled at the inner and outer spels of the surfels.
+* The moments being integers, the convolution results are rounded,
+* so that the estimations are the ones of the two former estimators.
+*
+* The kind of estimator is deduced from the functor: if its argument
+* is the covariance matrix type, the covariance matrix is computed
+* (as IntegralInvariantCovarianceEstimator), otherwise the volume
+* (as IntegralInvariantVolumeEstimator).
+*
+* Contrary to the two former estimators, the moments are only
+* available at the surfels given to init(). Once initialized, several
+* ranges of surfels may be evaluated concurrently by the range eval()
+* method, which uses its own copy of the functor.
+*
+* @note This class requires FFTW3 in double precision
+* (WITH_FFTW3 and WITH_FFTW3_DOUBLE).
+*
+* @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
+* in which the shape is defined.
+*
+* @tparam TPointPredicate a model of concepts::CPointPredicate, a predicate
+* Point -> bool that defines a digital shape as a characteristic
+* function.
+*
+* @tparam TFunctor the functor transforming the volume (e.g.
+* IIGeometricFunctors::IIMeanCurvature3DFunctor) or the covariance
+* matrix (e.g. IIGeometricFunctors::IIGaussianCurvature3DFunctor)
+* into a quantity.
+*
+* @see testIntegralInvariantFFTEstimator.cpp
+*/
+template <typename TKSpace, typename TPointPredicate, typename TFunctor>
+class IntegralInvariantFFTEstimator
+{
+public:
+  typedef IntegralInvariantFFTEstimator< TKSpace, TPointPredicate, TFunctor> Self;
+  typedef TKSpace KSpace;
+  typedef TPointPredicate PointPredicate;
+  typedef TFunctor Functor;
+
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+  BOOST_CONCEPT_ASSERT (( concepts::CPointPredicate< PointPredicate > ));
+
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef typename Space::RealPoint RealPoint;
+  typedef typename Domain::Size Size;
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Surfel Surfel;
+
+  /// The returned type of the estimator, depends on the functor
+  typedef typename Functor::Quantity Quantity;
+  typedef double Scalar;
+  /// The covariance matrix type.
+  typedef SimpleMatrix< double, Space::dimension, Space::dimension > Matrix;
+  /// The FFT engine.
+  typedef RealFFT< Domain, double > FFT;
+  typedef ImplicitBall<Space> KernelSupport;
+  typedef GaussDigitizer< Space, KernelSupport > DigitalShapeKernel;
+
+  /// True if the functor argument is the covariance matrix, false
+  /// if it is the volume.
+  static const bool isCovariance = std::is_same< typename Functor::Argument, Matrix >::value;
+  /// The number of convolved moments.
+  static const Dimension nbMoments;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Default constructor. The object is invalid. The user needs to call
+  * setParams and attach.
+  *
+  * @param[in] fct the functor for transforming the volume or the
+  * covariance matrix into some quantity. If not precised, a default
+  * object is instantiated.
+  */
+  IntegralInvariantFFTEstimator( Functor fct = Functor() );
+
+  /**
+  * Constructor.
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param[in] aPointPredicate the shape of interest. The alias can be secured
+  * if a some counted pointer is handed.
+  * @param[in] fct the functor for transforming the volume or the
+  * covariance matrix into some quantity. If not precised, a default
+  * object is instantiated.
+  */
+  IntegralInvariantFFTEstimator( ConstAlias< KSpace > K,
+                                 ConstAlias< PointPredicate > aPointPredicate,
+                                 Functor fct = Functor() );
+
+  /**
+  * Clears the object. It is now invalid.
+  */
+  void clear();
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /// @return the grid step.
+  Scalar h() const;
+
+  /**
+  * Attach a shape, defined as a functor spel -> boolean
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param aPointPredicate the shape of interest. The alias can be secured
+  * if a some counted pointer is handed.
+  */
+  void attach( ConstAlias< KSpace > K,
+               ConstAlias<PointPredicate> aPointPredicate );
+
+  /**
+  * Set specific parameters: the radius of the ball.
+  *
+  * @param[in] dRadius the "digital" radius of the kernel (but may be non integer).
+  */
+  void setParams( const double dRadius );
+
+  /**
+  * Model of CDigitalSurfaceLocalEstimator. Initialisation: convolves
+  * the shape with the moment kernels and keeps the moments at the
+  * inner and outer spels of the surfels of [itb,ite).
+  *
+  * @tparam SurfelConstIterator any model of forward readable iterator on Surfel.
+  * @param[in] _h grid size (must be >0).
+  * @param[in] itb iterator on the first surfel of the surface.
+  * @param[in] ite iterator after the last surfel of the surface.
+  */
+  template <typename SurfelConstIterator>
+  void init( const double _h, SurfelConstIterator itb, SurfelConstIterator ite );
+
+  /**
+  * -- Estimation --
+  *
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] it iterator pointing on the surfel of the shape where
+  * we wish to evaluate some geometric information. The surfel must
+  * belong to the range given to init().
+  *
+  * @return the quantity at surfel *it
+  */
+  template< typename SurfelConstIterator >
+  Quantity eval ( SurfelConstIterator it ) const;
+
+  /**
+  * -- Estimation --
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result output iterator of results of the computation.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator eval( SurfelConstIterator itb,
+                       SurfelConstIterator ite,
+                       OutputIterator result ) const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  Functor myFct;                                        ///< The functor that transforms the volume or the covariance matrix into a quantity.
+  CountedConstPtrOrConstPtr<KSpace> myKSpace;           ///< Smart pointer on the cellular grid space.
+  CountedConstPtrOrConstPtr<PointPredicate> myPointPredicate; ///< Smart pointer (if required) on a point predicate.
+  Domain myDomain;                                      ///< The padded domain of the convolutions.
+  std::vector<Size> myIndices;                          ///< Sorted linear indices of the spels where the moments are kept.
+  std::vector<double> myMoments;                        ///< nbMoments moments per index of myIndices.
+  Scalar myH;                                           ///< precision of the grid
+  Scalar myRadius;                                      ///< "digital" radius of the kernel (but may be non integer).
+
+  // ------------------------- Hidden services ------------------------------
+private:
+
+  /**
+  * @param n an extent.
+  * @return the smallest extent not smaller than \a n whose prime
+  * factors are 2, 3, 5 or 7.
+  */
+  static Size smoothSize( Size n );
+
+  /**
+  * @param i a dimension.
+  * @param j a dimension not smaller than i.
+  * @return the index of the moment x_i x_j.
+  */
+  static Dimension momentIndex( Dimension i, Dimension j );
+
+  /**
+  * @param m a moment index.
+  * @param k a kernel offset.
+  * @return the weight of the offset \a k in the kernel of the moment \a m.
+  */
+  static double momentWeight( Dimension m, const Point & k );
+
+  /**
+  * @param aPoint a spel center kept at init.
+  * @return a pointer on the nbMoments moments at this point.
+  */
+  const double* moments( const Point & aPoint ) const;
+
+  /**
+  * @param fct the functor applied to the moments.
+  * @param it iterator pointing on a surfel given to init().
+  * @return the quantity at surfel *it.
+  */
+  template< typename SurfelConstIterator >
+  Quantity evalSurfel( const Functor & fct, SurfelConstIterator it ) const;
+
+  /// @return the quantity of the volume functor for the given moments.
+  static Quantity evalMoments( const Functor & fct,
+                               const double* innerMoments, const double* outerMoments,
+                               std::false_type );
+
+  /// @return the quantity of the covariance functor for the given moments.
+  static Quantity evalMoments( const Functor & fct,
+                               const double* innerMoments, const double* outerMoments,
+                               std::true_type );
+
+  /// @return the covariance matrix corresponding to the given moments.
+  static Matrix covarianceMatrix( const double* someMoments );
+
+}; // end of class IntegralInvariantFFTEstimator
+
+  /**
+  * Overloads 'operator<<' for displaying objects of class 'IntegralInvariantFFTEstimator'.
+  * @param out the output stream where the object is written.
+  * @param object the object of class 'IntegralInvariantFFTEstimator' to write.
+  * @return the output stream after the writing.
+  */
+  template <typename TKSpace, typename TPointPredicate, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IntegralInvariantFFTEstimator<TKSpace, TPointPredicate, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantFFTEstimator_h
+
+#undef IntegralInvariantFFTEstimator_RECURSES
+#endif // else defined(IntegralInvariantFFTEstimator_RECURSES)
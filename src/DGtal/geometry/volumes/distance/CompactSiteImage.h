@@ -0,0 +1,423 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompactSiteImage.h
+ * @brief Compact storage of Voronoi sites for VoronoiMap and PowerMap
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module CompactSiteImage.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testCompactSiteImage.cpp
+ */
+
+#if defined(CompactSiteImage_RECURSES)
+#error Recursive header files inclusion detected in CompactSiteImage.h
+#else // defined(CompactSiteImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompactSiteImage_RECURSES
+
+#if !defined CompactSiteImage_h
+/** Prevents repeated inclusion of headers. */
+#define CompactSiteImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LinearIndexSiteEncoder
+  /**
+   * Description of template class 'LinearIndexSiteEncoder' <p>
+   * \brief Aim: Encodes a Voronoi site as its linear index in the
+   * (hyper-rectangular) domain.
+   *
+   * The site at infinity (all coordinates equal to the maximal
+   * coordinate value, as used by VoronoiMap and PowerMap) is encoded
+   * by the maximal index value. Sites must lie in the domain, this
+   * encoder can thus not be used for periodic Voronoi maps (see
+   * OffsetSiteEncoder).
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TIndex unsigned integer type of the codes, must be large
+   * enough to index all the domain points (plus one).
+   */
+  template <typename TDomain, typename TIndex = DGtal::uint32_t>
+  struct LinearIndexSiteEncoder
+  {
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef TIndex Code;
+    typedef Linearizer<Domain, ColMajorStorage> Linear;
+
+    /**
+     * Constructor.
+     * @param aDomain the domain of the sites.
+     * @throw InputException if @a TIndex cannot index all the points
+     * of @a aDomain.
+     */
+    LinearIndexSiteEncoder( const Domain & aDomain )
+      : myDomain( aDomain ), myLowerBound( aDomain.lowerBound() ),
+        myExtent( aDomain.upperBound() - aDomain.lowerBound() + Point::diagonal( 1 ) ),
+        myInfinity( Point::diagonal( NumberTraits< typename Point::Coordinate >::max() ) )
+    {
+      // The maximal code is reserved to the site at infinity.
+      if ( static_cast<double>( aDomain.size() ) >= static_cast<double>( NumberTraits<Code>::max() ) )
+        {
+          trace.error() << "[LinearIndexSiteEncoder] index type too small for the domain "
+                        << aDomain << std::endl;
+          throw InputException();
+        }
+    }
+
+    /**
+     * @param aPoint the point at which the site is stored (unused).
+     * @param aSite a site in the domain, or the site at infinity.
+     * @return the code of @a aSite.
+     */
+    Code encode( const Point & /*aPoint*/, const Point & aSite ) const
+    {
+      if ( aSite == myInfinity )
+        return NumberTraits<Code>::max();
+      ASSERT( myDomain.isInside( aSite )
+              && "LinearIndexSiteEncoder: site outside the domain (periodic domains are not supported)." );
+      return static_cast<Code>( Linear::getIndex( aSite, myLowerBound, myExtent ) );
+    }
+
+    /**
+     * @param aPoint the point at which the site is stored (unused).
+     * @param aCode a code returned by encode.
+     * @return the decoded site.
+     */
+    Point decode( const Point & /*aPoint*/, const Code aCode ) const
+    {
+      if ( aCode == NumberTraits<Code>::max() )
+        return myInfinity;
+      return Linear::getPoint( aCode, myLowerBound, myExtent );
+    }
+
+    /// Domain of the sites.
+    Domain myDomain;
+    /// Lower bound of the domain.
+    Point myLowerBound;
+    /// Extent of the domain.
+    Point myExtent;
+    /// Site at infinity.
+    Point myInfinity;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OffsetSiteEncoder
+  /**
+   * Description of template class 'OffsetSiteEncoder' <p>
+   * \brief Aim: Encodes a Voronoi site as its offset to the point at
+   * which it is stored, each coordinate of the offset being stored in
+   * a small integer type.
+   *
+   * Contrary to LinearIndexSiteEncoder, sites may lie outside the
+   * domain, which is the case of periodic Voronoi maps. The
+   * difference between a point and its site must be representable
+   * (along each axis) by @a TOffset, the minimal value of @a TOffset
+   * being reserved to encode the site at infinity.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TOffset signed integer type of the offset coordinates.
+   */
+  template <typename TDomain, typename TOffset = DGtal::int16_t>
+  struct OffsetSiteEncoder
+  {
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Point::Coordinate Coordinate;
+    typedef std::array< TOffset, Point::dimension > Code;
+
+    /**
+     * Constructor.
+     *
+     * The sites computed by VoronoiMap and PowerMap, periodic or
+     * not, are at most one extent of the domain away from the
+     * points they are stored at. Their offsets are thus representable
+     * if each extent of the domain is.
+     *
+     * @param aDomain the domain of the sites.
+     * @throw InputException if an extent of @a aDomain is larger than
+     * the maximal value of @a TOffset.
+     */
+    OffsetSiteEncoder( const Domain & aDomain )
+      : myInfinity( Point::diagonal( NumberTraits< Coordinate >::max() ) )
+    {
+      for ( typename Point::Dimension i = 0; i < Point::dimension; ++i )
+        if ( static_cast<double>( aDomain.upperBound()[ i ] ) - static_cast<double>( aDomain.lowerBound()[ i ] ) + 1.0
+             > static_cast<double>( NumberTraits<TOffset>::max() ) )
+          {
+            trace.error() << "[OffsetSiteEncoder] offset type too small for the domain "
+                          << aDomain << std::endl;
+            throw InputException();
+          }
+    }
+
+    /**
+     * @param aPoint the point at which the site is stored.
+     * @param aSite a site, or the site at infinity. Its offset to @a
+     * aPoint must be representable, which is the case of the sites
+     * of VoronoiMap and PowerMap (see the constructor).
+     * @return the code of @a aSite.
+     */
+    Code encode( const Point & aPoint, const Point & aSite ) const
+    {
+      Code code;
+      if ( aSite == myInfinity )
+        {
+          code.fill( NumberTraits<TOffset>::min() );
+          return code;
+        }
+      for ( typename Point::Dimension i = 0; i < Point::dimension; ++i )
+        {
+          ASSERT( aSite[ i ] - aPoint[ i ] > static_cast<Coordinate>( NumberTraits<TOffset>::min() )
+                  && aSite[ i ] - aPoint[ i ] <= static_cast<Coordinate>( NumberTraits<TOffset>::max() )
+                  && "OffsetSiteEncoder: offset type too small for the domain." );
+          code[ i ] = static_cast<TOffset>( aSite[ i ] - aPoint[ i ] );
+        }
+      return code;
+    }
+
+    /**
+     * @param aPoint the point at which the site is stored.
+     * @param aCode a code returned by encode.
+     * @return the decoded site.
+     */
+    Point decode( const Point & aPoint, const Code & aCode ) const
+    {
+      if ( aCode[ 0 ] == NumberTraits<TOffset>::min() )
+        return myInfinity;
+      Point site = aPoint;
+      for ( typename Point::Dimension i = 0; i < Point::dimension; ++i )
+        site[ i ] += static_cast<Coordinate>( aCode[ i ] );
+      return site;
+    }
+
+    /// Site at infinity.
+    Point myInfinity;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompactSiteImage
+  /**
+   * Description of template class 'CompactSiteImage' <p>
+   * \brief Aim: Model of concepts::CImage storing, for each point of a
+   * hyper-rectangular domain, a site (a point of the space) in a
+   * compact encoded form.
+   *
+   * This image is meant to be used as the output image container of
+   * VoronoiMap and PowerMap (and thus DistanceTransformation,
+   * ReverseDistanceTransformation and ReducedMedialAxis) when
+   * memory is an issue. Instead of a full Point per domain point, a
+   * code defined by @a TSiteEncoder is stored:
+   *
+   * - LinearIndexSiteEncoder (default) stores the linear index of
+   *   the site in the domain (4 bytes with the default index type
+   *   instead of 12 bytes for a Z3i::Point). Only non-periodic maps
+   *   are supported.
+   * - OffsetSiteEncoder stores the offset from the point to its site
+   *   using 16 bits per axis (6 bytes in dimension 3) and supports
+   *   periodic maps.
+   *
+   * The values are decoded on the fly by operator(), which returns
+   * the site as a Vector, as expected by VoronoiMap and PowerMap.
+   *
+   * @code
+   * typedef CompactSiteImage< Z3i::Domain > SiteImage;
+   * typedef DistanceTransformation< Z3i::Space, Predicate, L2Metric, SiteImage > DT;
+   * DT dt( domain, predicate, l2 );
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TSiteEncoder the site encoder (LinearIndexSiteEncoder or
+   * OffsetSiteEncoder or any type with the same interface).
+   */
+  template < typename TDomain,
+             typename TSiteEncoder = LinearIndexSiteEncoder<TDomain> >
+  class CompactSiteImage
+  {
+  public:
+
+    typedef CompactSiteImage<TDomain, TSiteEncoder> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// site encoder
+    typedef TSiteEncoder SiteEncoder;
+    typedef typename SiteEncoder::Code Code;
+    typedef std::vector< Code > Container;
+
+    /// range of values
+    typedef Vector Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /////////////////// standard services //////////////////
+  public:
+
+    /**
+     * Constructor. All points are associated to the site at infinity.
+     *
+     * @param aDomain the image domain.
+     * @throw InputException if the codes of the site encoder cannot
+     * represent the sites of @a aDomain.
+     */
+    CompactSiteImage( const Domain & aDomain );
+
+    /**
+     * Default destructor.
+     */
+    ~CompactSiteImage() = default;
+
+    /////////////////// Interface //////////////////
+  public:
+
+    /**
+     * Get the site stored at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the (decoded) site at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the site stored at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @param aValue the site.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    Range range();
+
+    /**
+     * @return a const reference to the underlying container of codes.
+     */
+    const Container & container() const;
+
+    /**
+     * @return the number of bytes used to store the codes.
+     */
+    std::size_t memorySize() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /////////////////// Data members //////////////////
+  private:
+
+    /// Image domain.
+    Domain myDomain;
+    /// Domain extent.
+    Point myExtent;
+    /// Site encoder.
+    SiteEncoder myEncoder;
+    /// Codes of the sites (column-major order).
+    Container myCodes;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in myCodes.
+     */
+    Size index( const Point & aPoint ) const;
+
+  }; // end of class CompactSiteImage
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompactSiteImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompactSiteImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TSiteEncoder>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompactSiteImage<TDomain, TSiteEncoder> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/CompactSiteImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompactSiteImage_h
+
+#undef CompactSiteImage_RECURSES
+#endif // else defined(CompactSiteImage_RECURSES)
@@ -0,0 +1,507 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseFMM.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DenseFMM.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testDenseFMM.cpp
+ */
+
+#if defined(DenseFMM_RECURSES)
+#error Recursive header files inclusion detected in DenseFMM.h
+#else // defined(DenseFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseFMM_RECURSES
+
+#if !defined DenseFMM_h
+/** Prevents repeated inclusion of headers. */
+#define DenseFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseFMM
+  /**
+   * Description of template class 'DenseFMM' <p>
+   * \brief Aim: Fast Marching Method (FMM) for nd distance transforms
+   * on images whose domain is a HyperRectDomain.
+   *
+   * This class has the same interface and computes exactly the same
+   * values as FMM, but its candidate points are stored in an indexed
+   * binary heap instead of an STL set of pairs (point, tentative
+   * value). The points are identified by their linear index in the
+   * image domain, and a dense array gives, for each point, its
+   * position in the heap or its state (unvisited or accepted). Hence:
+   * - extracting the candidate of min value is a heap pop, without
+   *   any node allocation;
+   * - updating the tentative value of a candidate is a decrease-key
+   *   instead of the insertion of a second pair;
+   * - testing if a point is accepted does not require a look-up in
+   *   the set of accepted points.
+   *
+   * The ordering of the candidates is the one of FMM (absolute value,
+   * then point order), so that the accepted points are visited in the
+   * same order. As in FMM, the propagation may be restricted to a
+   * narrow band by an area threshold (maximal number of accepted
+   * points) and by a value threshold (maximal absolute distance
+   * value).
+   *
+   * The extra memory is one index and one bit per point of the image
+   * domain (the domain of @a aImg given at construction). Points outside this
+   * domain are never candidates, whatever the point predicate.
+   *
+   * The image and the set of accepted points are initialized as for
+   * FMM, e.g. with FMM::initFromPointsRange or
+   * FMM::initFromBelsRange. The accepted points are also recorded in a
+   * DigitalSetByBitset over the image domain (one bit per point). The
+   * default point functor evaluates the distance values from this
+   * dense set, so that its neighbor look-ups do not depend on the type
+   * of @a TSet. A point functor on @a TSet, as in FMM, may still be
+   * given (see testDenseFMM-benchmark.cpp).
+   *
+   * @tparam TImage  any model of CImage whose domain is a HyperRectDomain
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value, whose set type is either
+   * DenseAcceptedPointSet or @a TSet
+   *
+   * @see FMM
+   * @see testDenseFMM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,
+              DigitalSetByBitset<typename TImage::Domain> > >
+  class DenseFMM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+    typedef typename Image::Domain Domain;
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<typename Domain::Space> >::value ));
+    /// Dense set of accepted points, read by the default point functor
+    typedef DigitalSetByBitset<Domain> DenseAcceptedPointSet;
+
+    //points
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+    static const Dimension dimension = Point::dimension;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+    typedef DGtal::uint64_t Area;
+
+  private:
+
+    //intern data types
+    typedef std::size_t Index;
+    /// Row-major indices are ordered as the points (lexicographic order)
+    typedef Linearizer<Domain, RowMajorStorage> Linear;
+
+    /// Candidate point: linear index and tentative value.
+    struct HeapNode
+    {
+      Value value;
+      Index index;
+    };
+
+    /// Heap position of a point that is not a candidate yet.
+    static const Index UNVISITED = std::numeric_limits<Index>::max();
+    /// Heap position of an accepted point.
+    static const Index ACCEPTED = std::numeric_limits<Index>::max() - 1;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Reference on the image
+     */
+    Image& myImage;
+
+    /**
+     * Reference on the set of accepted points
+     */
+    AcceptedPointSet& myAcceptedPoints;
+
+    /**
+     * Copy of the image domain, used to linearize the points
+     */
+    Domain myDomain;
+
+    /**
+     * Extent of the image domain
+     */
+    Point myExtent;
+
+    /**
+     * Accepted points of the image domain, as a bitset
+     */
+    DenseAcceptedPointSet myDenseAcceptedPoints;
+
+    /**
+     * Binary heap of candidate points
+     */
+    std::vector<HeapNode> myHeap;
+
+    /**
+     * For each point of the domain, its position in the heap,
+     * UNVISITED or ACCEPTED
+     */
+    std::vector<Index> myPositions;
+
+    /**
+     * Pointer on the point functor used to deduce
+     * the distance of a new point
+     * from the distance of its neighbors
+     */
+    PointFunctor* myPointFunctorPtr;
+
+    /**
+     * 'true' if @a myPointFunctorPtr is an owning pointer
+     * (default case), 'false' if it is an aliasing pointer
+     * on a point functor given at construction
+     */
+    const bool myFlagIsOwning;
+
+    /**
+     * Constant reference on a point predicate that returns
+     * 'true' inside the domain
+     * where the distance transform is performed
+     */
+    const PointPredicate& myPointPredicate;
+
+    /**
+     * Area threshold (in number of accepted points)
+     * above which the propagation stops
+     */
+    Area myAreaThreshold;
+
+    /**
+     * Value threshold above which the propagation stops
+     */
+    Value myValueThreshold;
+
+    /**
+     * Min value
+     */
+    Value myMinValue;
+
+    /**
+     * Max value
+     */
+    Value myMaxValue;
+
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the computation
+     * @param aSet the (non empty) set of accepted points
+     * @param aPointPredicate point predicate bounding the computation
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+             ConstAlias<PointPredicate> aPointPredicate);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the computation
+     * @param aSet the (non empty) set of accepted points
+     * @param aPointPredicate point predicate bounding the computation
+     * @param aAreaThreshold maximal number of accepted points
+     * @param aValueThreshold maximal absolute distance value
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+             ConstAlias<PointPredicate> aPointPredicate,
+             const Area& aAreaThreshold, const Value& aValueThreshold);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the computation
+     * @param aSet the (non empty) set of accepted points
+     * @param aPointPredicate point predicate bounding the computation
+     * @param aPointFunctor point functor computing the tentative values
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+             ConstAlias<PointPredicate> aPointPredicate,
+             PointFunctor& aPointFunctor );
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the computation
+     * @param aSet the (non empty) set of accepted points
+     * @param aPointPredicate point predicate bounding the computation
+     * @param aAreaThreshold maximal number of accepted points
+     * @param aValueThreshold maximal absolute distance value
+     * @param aPointFunctor point functor computing the tentative values
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+             ConstAlias<PointPredicate> aPointPredicate,
+             const Area& aAreaThreshold, const Value& aValueThreshold,
+             PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~DenseFMM();
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by marching out
+     * from the initial set of accepted points.
+     * While it is possible, the candidate of min distance is
+     * inserted into the set of accepted points.
+     *
+     * @see computeOneStep
+     */
+    void compute();
+
+    /**
+     * Inserts the candidate of min distance into the set
+     * of accepted points if it is possible and then
+     * updates the distance values associated to the candidate points.
+     *
+     * @param aPoint inserted point (if inserted)
+     * @param aValue its distance value (if inserted)
+     *
+     * @return 'true' if the point of min distance is accepted
+     * 'false' otherwise.
+     */
+    bool computeOneStep(Point& aPoint, Value& aValue);
+
+    /**
+     * Minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value
+     */
+    Value max() const;
+
+    /**
+     * Computes the minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value getMin() const;
+
+    /**
+     * Computes the maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value.
+     */
+    Value getMax() const;
+
+    /**
+     * @return the number of candidate points.
+     */
+    std::size_t nbCandidates() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    DenseFMM ( const DenseFMM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    DenseFMM & operator= ( const DenseFMM & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the dense set of accepted points, when the point
+     * functor reads a DenseAcceptedPointSet.
+     */
+    static DenseAcceptedPointSet& functorSet( DenseAcceptedPointSet& aDenseSet,
+                                              AcceptedPointSet& aSet,
+                                              std::true_type );
+
+    /**
+     * @return the set of accepted points @a aSet, when the point
+     * functor reads an AcceptedPointSet.
+     */
+    static AcceptedPointSet& functorSet( DenseAcceptedPointSet& aDenseSet,
+                                         AcceptedPointSet& aSet,
+                                         std::false_type );
+
+    /**
+     * Marks the accepted points and initializes the heap of
+     * candidate points.
+     */
+    void init();
+
+    /**
+     * Inserts the candidate of min distance into the set
+     * of accepted points and updates the distance values
+     * of the candidate points.
+     *
+     * @param aPoint inserted point (if true)
+     * @param aValue distance value of the inserted point (if true)
+     *
+     * @return 'true' if the point of min distance is accepted
+     * 'false' otherwise.
+     */
+    bool addNewAcceptedPoint(Point& aPoint, Value& aValue);
+
+    /**
+     * Updates the distance values of the neighbors of @a aPoint.
+     *
+     * @param aPoint any accepted point
+     */
+    void update(const Point& aPoint);
+
+    /**
+     * Tests a new point as a candidate.
+     * If it lies in the image domain, is not yet accepted
+     * and if the point predicate returns 'true',
+     * computes its distance and inserts it into the heap or
+     * decreases its key.
+     *
+     * @param aPoint any point
+     *
+     * @return 'true' if inserted or updated,
+     * 'false' otherwise.
+     */
+    bool addNewCandidate(const Point& aPoint);
+
+    /**
+     * Candidate ordering of FMM: absolute value, then point order.
+     *
+     * @param a a candidate
+     * @param b another candidate
+     * @return 'true' if @a a is before @a b.
+     */
+    bool isBefore( const HeapNode & a, const HeapNode & b ) const;
+
+    /**
+     * Moves up the heap node at position @a aPos.
+     * @param aPos a position in the heap
+     */
+    void siftUp( Index aPos );
+
+    /**
+     * Moves down the heap node at position @a aPos.
+     * @param aPos a position in the heap
+     */
+    void siftDown( Index aPos );
+
+  }; // end of class DenseFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseFMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/DenseFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseFMM_h
+
+#undef DenseFMM_RECURSES
+#endif // else defined(DenseFMM_RECURSES)
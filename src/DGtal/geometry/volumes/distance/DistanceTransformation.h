@@ -125,9 +125,9 @@ namespace DGtal
                          typename SeparableMetric::Point>::value));
 
     ///Definition of the image.
-    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> Self;
+    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Self;
 
-    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric> Parent;
+    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Parent;
 
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
@@ -144,10 +144,14 @@ namespace DGtal
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           ThreadPool * aThreadPool = nullptr,
+                           VoronoiMapEngine anEngine = VoronoiMapTiles):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          aThreadPool,
+                                                                          anEngine)
     {}
 
     /**
@@ -158,11 +162,15 @@ namespace DGtal
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
                            ConstAlias<SeparableMetric> aMetric,
-                           typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                           ThreadPool * aThreadPool = nullptr,
+                           VoronoiMapEngine anEngine = VoronoiMapTiles)
       : VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                             predicate,
                                                                             aMetric,
-                                                                            aPeriodicitySpec)
+                                                                            aPeriodicitySpec,
+                                                                            aThreadPool,
+                                                                            anEngine)
     {}
 
     /**
@@ -253,11 +261,11 @@ namespace DGtal
 // //                                                                           //
 // ///////////////////////////////////////////////////////////////////////////////
 
-  template <typename S,typename P,typename TSep>
+  template <typename S,typename P,typename TSep,typename TImage>
   inline
   std::ostream&
   operator<< ( std::ostream & out,
-               const DistanceTransformation<S,P,TSep> & object )
+               const DistanceTransformation<S,P,TSep,TImage> & object )
   {
     object.selfDisplay( out );
     return out;
@@ -0,0 +1,402 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DynamicDistanceTransformation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DynamicDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testDynamicDistanceTransformation.cpp
+ */
+
+#if defined(DynamicDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in DynamicDistanceTransformation.h
+#else // defined(DynamicDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DynamicDistanceTransformation_RECURSES
+
+#if !defined DynamicDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define DynamicDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DynamicDistanceTransformation
+  /**
+   * Description of template class 'DynamicDistanceTransformation' <p>
+   * \brief Aim: Distance transformation (and Voronoi map) for
+   * separable metrics that can be updated after batched insertions
+   * and deletions of sites.
+   *
+   * The separable Voronoi map algorithm (see VoronoiMap) computes d
+   * successive maps, the k-th one giving for each point its closest
+   * site among the sites of the k-dimensional affine subspace spanned
+   * by the first k+1 axes. This class keeps the d maps: when the set of
+   * sites is edited, only the 1D lines along dimension k containing a
+   * point whose (k-1)-th map value changed are recomputed, and the
+   * points whose k-th value changed are propagated to the next
+   * dimension. For local edits, the update cost is thus proportional
+   * to the size of the region whose Voronoi sites change (times the
+   * domain extents) instead of the domain size.
+   *
+   * The result is exactly the one of DistanceTransformation with the
+   * same sites (and the same metric and periodicity). The memory
+   * footprint is d images of vectors instead of one.
+   *
+   * This class is a model of concepts::CConstImage.
+   *
+   * @code
+   * DynamicDistanceTransformation<Z3i::Space, L2Metric> dt( domain, predicate, l2 );
+   * dt.update( newSites, removedSites ); // both are ranges of points
+   * trace.info() << dt( p ) << std::endl;
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric
+   * @tparam TImageContainer any model of concepts::CImage to store the
+   * Voronoi maps (default: ImageContainerBySTLVector) with
+   * TSpace::Vector values.
+   *
+   * @see DistanceTransformation
+   * @see VoronoiMap
+   */
+  template < typename TSpace,
+             typename TSeparableMetric,
+             typename TImageContainer =
+               ImageContainerBySTLVector< HyperRectDomain<TSpace>,
+                                          typename TSpace::Vector > >
+  class DynamicDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the metric type.
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Type of the images storing the Voronoi maps.
+    typedef TImageContainer OutputImage;
+
+    ///Domain type.
+    typedef typename OutputImage::Domain Domain;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    BOOST_STATIC_ASSERT(( boost::is_same< typename OutputImage::Value, Vector >::value ));
+
+    ///Definition of the image value type (distances).
+    typedef typename SeparableMetric::Value Value;
+
+    ///Self type.
+    typedef DynamicDistanceTransformation<TSpace, TSeparableMetric, TImageContainer> Self;
+
+    ///Definition of the image constRange.
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    ///Periodicity specification type.
+    typedef std::array< bool, Space::dimension > PeriodicitySpec;
+
+    /**
+     * Constructor in the non-periodic case. The initial sites are the
+     * points of the domain for which @a aPredicate is false (as for
+     * DistanceTransformation). The predicate is only used during the
+     * construction.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     * @param aPredicate the point predicate defining the initial sites.
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     */
+    template <typename TPointPredicate>
+    DynamicDistanceTransformation( ConstAlias<Domain> aDomain,
+                                   const TPointPredicate & aPredicate,
+                                   ConstAlias<SeparableMetric> aMetric,
+                                   ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * Constructor with periodicity specification.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     * @param aPredicate the point predicate defining the initial sites.
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aPeriodicitySpec an array of size equal to the space
+     * dimension where the i-th value is true if the i-th dimension is
+     * periodic, false otherwise.
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     */
+    template <typename TPointPredicate>
+    DynamicDistanceTransformation( ConstAlias<Domain> aDomain,
+                                   const TPointPredicate & aPredicate,
+                                   ConstAlias<SeparableMetric> aMetric,
+                                   PeriodicitySpec const & aPeriodicitySpec,
+                                   ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * Default constructor (deleted).
+     */
+    DynamicDistanceTransformation() = delete;
+
+    /**
+     * Destructor.
+     */
+    ~DynamicDistanceTransformation() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Inserts and removes sites, and repairs the maps. Points of
+     * @a newSites that are already sites and points of @a
+     * removedSites that are not sites are ignored. Insertions are
+     * done before deletions.
+     *
+     * @tparam TPointRange1 a range of points (with begin() and end()).
+     * @tparam TPointRange2 a range of points (with begin() and end()).
+     * @param newSites the points becoming sites.
+     * @param removedSites the points that are no longer sites.
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     * @return the number of points whose closest site changed.
+     */
+    template <typename TPointRange1, typename TPointRange2>
+    Size update( const TPointRange1 & newSites,
+                 const TPointRange2 & removedSites,
+                 ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * Inserts sites, see update.
+     *
+     * @param newSites a range of points becoming sites.
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     * @return the number of points whose closest site changed.
+     */
+    template <typename TPointRange>
+    Size insertSites( const TPointRange & newSites,
+                      ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * Removes sites, see update.
+     *
+     * @param removedSites a range of points that are no longer sites.
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     * @return the number of points whose closest site changed.
+     */
+    template <typename TPointRange>
+    Size removeSites( const TPointRange & removedSites,
+                      ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return 'true' if @a aPoint is a site.
+     */
+    bool isSite( const Point & aPoint ) const;
+
+    /**
+     * @return the domain of the transformation.
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * @return a const range on the distance values.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Access to a distance value at a point (i.e. the distance to its
+     * closest site).
+     *
+     * @param aPoint the point to probe.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Access to the closest site of a point.
+     *
+     * @param aPoint the point to probe.
+     */
+    Vector getVoronoiVector( const Point & aPoint ) const;
+
+    /**
+     * @return the underlying metric.
+     */
+    const SeparableMetric * metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// VoronoiMap engine type, whose 1D solver is used line by line.
+    typedef VoronoiMap< Space, functors::TruePointPredicate<Point>,
+                        SeparableMetric, OutputImage > VoronoiEngine;
+
+    /// Opens the 1D solver of VoronoiMap.
+    struct Engine : public VoronoiEngine
+    {
+      Engine( ConstAlias<Domain> aDomain, ConstAlias<SeparableMetric> aMetric,
+              PeriodicitySpec const & aPeriodicitySpec,
+              CountedPtr<OutputImage> anImage )
+        : VoronoiEngine( aDomain, nullptr, aMetric, aPeriodicitySpec,
+                         anImage, 0, 0 )
+      {}
+
+      using VoronoiEngine::computeOtherStep1D;
+    };
+
+    /**
+     * Initializes the sites and computes the maps.
+     * @param aPredicate the predicate defining the initial sites.
+     * @param aThreadPool if not null, the thread pool to use.
+     */
+    template <typename TPointPredicate>
+    void init( const TPointPredicate & aPredicate, ThreadPool * aThreadPool );
+
+    /**
+     * Recomputes the lines along dimension @a dim starting at the
+     * points of @a rows, the k-th map being computed from the (k-1)-th
+     * one (from the sites if @a dim is 0).
+     *
+     * @param dim the dimension.
+     * @param rows the starting points of the lines (with coordinate
+     * @a dim equal to the domain lower bound).
+     * @param changed if not null, filled with the points whose map
+     * value changed.
+     * @param aThreadPool if not null, the thread pool to use.
+     */
+    void recomputeLines( const Dimension dim, const std::vector<Point> & rows,
+                         std::vector<Point> * changed, ThreadPool * aThreadPool );
+
+    /**
+     * Sorts the starting points of the lines along @a dim containing
+     * the points of @a points, without duplicates.
+     *
+     * @param dim the dimension.
+     * @param points a set of points of the domain.
+     * @return the starting points of the lines.
+     */
+    std::vector<Point> linesThrough( const Dimension dim,
+                                     const std::vector<Point> & points ) const;
+
+    /// Pointer to the computation domain.
+    const Domain * myDomainPtr;
+
+    /// Pointer to the separable metric.
+    const SeparableMetric * myMetricPtr;
+
+    /// Periodicity along each dimension.
+    PeriodicitySpec myPeriodicitySpec;
+
+    /// Site flags.
+    ImageContainerBySTLVector< Domain, bool > mySites;
+
+    /// The d Voronoi maps (the last one is the final map).
+    std::vector< CountedPtr<OutputImage> > myMaps;
+
+    /// Engine solving the 1D problems.
+    CountedPtr<Engine> myEngine;
+
+    /// Value to act as a +infinity value.
+    Point myInfinity;
+
+  }; // end of class DynamicDistanceTransformation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DynamicDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DynamicDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename TSep, typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DynamicDistanceTransformation<S, TSep, TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/DynamicDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DynamicDistanceTransformation_h
+
+#undef DynamicDistanceTransformation_RECURSES
+#endif // else defined(DynamicDistanceTransformation_RECURSES)
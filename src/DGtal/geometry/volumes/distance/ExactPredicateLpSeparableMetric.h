@@ -395,6 +395,46 @@ namespace DGtal
                   const Point &endPoint,
                   const typename Point::UnsignedComponent dim) const;
 
+    // ----------------------- Batched services ------------------------------------
+    /**
+     * Computes, for each site of the array [@a sites, @a sites + @a
+     * nb), the sum of the squared differences with @a startingPoint
+     * along the dimensions other than @a dim. These partial
+     * distances do not depend on the position along the straight
+     * line, so that a separable algorithm can compute them once per
+     * site and then use hiddenByPartial. The loop has no branch on
+     * the sites and can be vectorized by the compiler.
+     *
+     * @param sites an array of sites
+     * @param nb the number of sites
+     * @param startingPoint a point of the straight line
+     * @param dim direction of the straight line
+     * @param partials the output array of @a nb partial distances
+     */
+    void partialRawDistances(const Point * sites,
+                             const std::size_t nb,
+                             const Point &startingPoint,
+                             const typename Point::UnsignedComponent dim,
+                             RawValue * partials) const;
+
+    /**
+     * Same predicate as hiddenBy, given the coordinates of the sites
+     * along the straight line and their partial distances (see
+     * partialRawDistances).
+     *
+     * @param udim coordinate of u along the straight line
+     * @param nu partial distance of u
+     * @param vdim coordinate of v along the straight line
+     * @param nv partial distance of v
+     * @param wdim coordinate of w along the straight line
+     * @param nw partial distance of w
+     *
+     * @return true if (u,w) hides v.
+     */
+    bool hiddenByPartial(const Abscissa &udim, const RawValue &nu,
+                         const Abscissa &vdim, const RawValue &nv,
+                         const Abscissa &wdim, const RawValue &nw) const;
+
    // ----------------------- Other services --------------------------------------
     /**
      * Writes/Displays the object on an output stream.
@@ -0,0 +1,362 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module OutOfCoreDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Distance transformation (and Voronoi map) of domains
+   * too large to be stored in memory, computed slab by slab.
+   *
+   * The Voronoi map is stored in a user-provided image @a TSiteImage,
+   * typically a TiledImage whose tiles are provided by an image
+   * factory on a disk (or memory-mapped) backing store, e.g.
+   * ImageFactoryFromHDF5. Only one slab of the domain is loaded in an
+   * in-core buffer at a time, the size of this buffer being bounded by
+   * a user given number of bytes:
+   *
+   * - the first d-1 separable steps are computed on slabs orthogonal to
+   *   the last dimension: the sites are initialized from the point
+   *   predicate and the map of the slab is written to the site image;
+   * - the last step is computed on slabs orthogonal to the first
+   *   dimension, read from and written back to the site image.
+   *
+   * The result is the same as the one of DistanceTransformation (and
+   * VoronoiMap) on the same domain. Each slab is processed by the
+   * VoronoiMap engine, so that a ThreadPool can be given to use
+   * several threads per slab. The overall memory footprint is the slab
+   * buffer plus the cache of the site image (see TiledImage and its
+   * cache policies).
+   *
+   * This class is a model of concepts::CConstImage.
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TPointPredicate point predicate returning false for points
+   * from which we compute the distance (model of concepts::CPointPredicate)
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric
+   * @tparam TSiteImage any model of concepts::CImage on a
+   * HyperRectDomain<TSpace> with TSpace::Vector values, storing the
+   * Voronoi map (e.g. TiledImage).
+   *
+   * @see DistanceTransformation
+   * @see VoronoiMap
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TSiteImage >
+  class OutOfCoreDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TSiteImage> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension >= 2 ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Copy of the metric type.
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Copy of the site image type.
+    typedef TSiteImage SiteImage;
+
+    ///Domain type.
+    typedef HyperRectDomain<TSpace> Domain;
+    BOOST_STATIC_ASSERT(( boost::is_same< typename SiteImage::Domain, Domain >::value ));
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    BOOST_STATIC_ASSERT(( boost::is_same< typename SiteImage::Value, Vector >::value ));
+
+    ///Definition of the image value type (distances).
+    typedef typename SeparableMetric::Value Value;
+
+    ///Self type.
+    typedef OutOfCoreDistanceTransformation<TSpace, TPointPredicate,
+                                            TSeparableMetric, TSiteImage> Self;
+
+    ///Definition of the image constRange.
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    ///Periodicity specification type.
+    typedef std::array< bool, Space::dimension > PeriodicitySpec;
+
+    ///In-core image type of a slab.
+    typedef ImageContainerBySTLVector<Domain, Vector> SlabImage;
+
+    /**
+     * Constructor in the non-periodic case.
+     *
+     * The computation is done at construction.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aSiteImage the image storing the Voronoi map (its
+     * domain must contain @a aDomain).
+     * @param aMaxSlabBytes maximal size (in bytes) of the in-core
+     * slab buffer (at least one hyperplane is loaded at a time).
+     * @param aThreadPool if not null, the thread pool used to process
+     * each slab.
+     */
+    OutOfCoreDistanceTransformation( ConstAlias<Domain> aDomain,
+                                     ConstAlias<PointPredicate> predicate,
+                                     ConstAlias<SeparableMetric> aMetric,
+                                     Alias<SiteImage> aSiteImage,
+                                     std::size_t aMaxSlabBytes,
+                                     ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * Constructor with periodicity specification.
+     *
+     * See the non-periodic constructor and VoronoiMap.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aPeriodicitySpec an array of size equal to the space
+     * dimension where the i-th value is true if the i-th dimension is
+     * periodic, false otherwise.
+     * @param aSiteImage the image storing the Voronoi map (its
+     * domain must contain @a aDomain).
+     * @param aMaxSlabBytes maximal size (in bytes) of the in-core
+     * slab buffer (at least one hyperplane is loaded at a time).
+     * @param aThreadPool if not null, the thread pool used to process
+     * each slab.
+     */
+    OutOfCoreDistanceTransformation( ConstAlias<Domain> aDomain,
+                                     ConstAlias<PointPredicate> predicate,
+                                     ConstAlias<SeparableMetric> aMetric,
+                                     PeriodicitySpec const & aPeriodicitySpec,
+                                     Alias<SiteImage> aSiteImage,
+                                     std::size_t aMaxSlabBytes,
+                                     ThreadPool * aThreadPool = nullptr );
+
+    /**
+     * Default constructor (deleted).
+     */
+    OutOfCoreDistanceTransformation() = delete;
+
+    /**
+     * Destructor.
+     */
+    ~OutOfCoreDistanceTransformation() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the transformation.
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * @return a const range on the distance values.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Access to a distance value at a point (i.e. the distance to its
+     * closest site). Reads the site image.
+     *
+     * @param aPoint the point to probe.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Access to the closest site of a point.
+     *
+     * @param aPoint the point to probe.
+     */
+    Vector getVoronoiVector( const Point & aPoint ) const;
+
+    /**
+     * @return the underlying metric.
+     */
+    const SeparableMetric * metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * @return the image storing the Voronoi map.
+     */
+    const SiteImage & siteImage() const
+    {
+      return *mySiteImagePtr;
+    }
+
+    /**
+     * @return the number of hyperplanes per slab of the first (resp.
+     * second) pass.
+     */
+    std::array< Size, 2 > slabThicknesses() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// VoronoiMap engine processing one slab.
+    typedef VoronoiMap< Space, PointPredicate, SeparableMetric, SlabImage > SlabVoronoiMap;
+
+    /// Opens the protected partial constructor of VoronoiMap.
+    struct SlabEngine : public SlabVoronoiMap
+    {
+      SlabEngine( ConstAlias<Domain> aDomain, const PointPredicate * predicate,
+                  ConstAlias<SeparableMetric> aMetric,
+                  PeriodicitySpec const & aPeriodicitySpec,
+                  CountedPtr<SlabImage> anImage,
+                  const Dimension aFirstDim, const Dimension aLastDim,
+                  ThreadPool * aThreadPool )
+        : SlabVoronoiMap( aDomain, predicate, aMetric, aPeriodicitySpec,
+                          anImage, aFirstDim, aLastDim, aThreadPool )
+      {}
+    };
+
+    /**
+     * Computes the Voronoi map slab by slab.
+     * @param aThreadPool if not null, the thread pool used per slab.
+     */
+    void compute( ThreadPool * aThreadPool );
+
+    /**
+     * @return the number of hyperplanes orthogonal to @a dim that fit
+     * in the slab buffer (at least 1).
+     * @param dim a dimension.
+     */
+    Size slabThickness( const Dimension dim ) const;
+
+    /// Pointer to the computation domain.
+    const Domain * myDomainPtr;
+
+    /// Pointer to the point predicate.
+    const PointPredicate * myPointPredicatePtr;
+
+    /// Pointer to the separable metric.
+    const SeparableMetric * myMetricPtr;
+
+    /// Pointer to the site image.
+    SiteImage * mySiteImagePtr;
+
+    /// Maximal size of the slab buffer, in bytes.
+    std::size_t myMaxSlabBytes;
+
+    /// Periodicity along each dimension.
+    PeriodicitySpec myPeriodicitySpec;
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename TSep, typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OutOfCoreDistanceTransformation<S, P, TSep, TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
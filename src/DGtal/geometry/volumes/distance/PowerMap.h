@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/CConstImage.h"
@@ -176,10 +177,13 @@ namespace DGtal
      * returning the weight for some points
      * @param aMetric a power
      * seprable metric instance.
+     * @param aThreadPool if not null, the thread pool used to solve
+     * the 1D problems (the pool is only used during the construction).
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
-             ConstAlias<PowerSeparableMetric> aMetric);
+             ConstAlias<PowerSeparableMetric> aMetric,
+             ThreadPool * aThreadPool = nullptr);
 
     /**
      * Constructor with periodicity specification.
@@ -201,11 +205,14 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     * @param aThreadPool if not null, the thread pool used to solve
+     *        the 1D problems (the pool is only used during the construction).
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
              ConstAlias<PowerSeparableMetric> aMetric,
-             PeriodicitySpec const & aPeriodicitySpec);
+             PeriodicitySpec const & aPeriodicitySpec,
+             ThreadPool * aThreadPool = nullptr);
 
     /**
      * Disable default constructor.
@@ -320,8 +327,11 @@ namespace DGtal
      * SeparableMetric metric.  The method associates to each point
      * satisfying the foreground predicate, the closest site for which
      * the predicate is false. This algorithm is O(d.|domain size|).
+     *
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
      */
-    void compute ( ) ;
+    void compute ( ThreadPool * aThreadPool ) ;
 
 
     /**
@@ -331,6 +341,18 @@ namespace DGtal
      */
     void computeOtherSteps(const Dimension dim) const;
 
+    /**
+     *  Compute the other steps of the separable Power map using the
+     *  threads of @a aThreadPool. Each task is a block of lines
+     *  adjacent along the lowest dimension other than @a dim, so that
+     *  the lines of a block share the cache lines of the image.
+     *
+     * @param dim the dimension to process
+     * @param aThreadPool the thread pool.
+     */
+    void computeOtherStepsInParallel(const Dimension dim,
+                                     ThreadPool & aThreadPool) const;
+
     /**
      * Given  a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
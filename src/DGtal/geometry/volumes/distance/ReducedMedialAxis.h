@@ -45,7 +45,11 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <utility>
+#include <algorithm>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
@@ -103,27 +107,72 @@ namespace DGtal
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$.
      *
+     * If a thread pool is given, the power map is scanned by blocks
+     * of points in parallel and the medial axis points found by each
+     * thread are inserted in the output container afterwards (the
+     * container does not need to support concurrent writes).
+     *
      * @param aPowerMap the input powerMap
+     * @param aThreadPool if not null, the thread pool used to scan
+     * the power map.
      *
      * @return a lightweight proxy to the ImageContainer specified in
      * template arguments.
      */
     static
-    Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap)
+    Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap,
+                                          ThreadPool * aThreadPool = nullptr)
     {
       TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
 
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(),
-             itend = aPowerMap.domain().end(); it != itend; ++it)
+      if ( aThreadPool == nullptr )
         {
-          const auto v  = aPowerMap( *it );
-          const auto pv = aPowerMap.projectPoint( v );
-
-          if ( aPowerMap.metricPtr()->powerDistance( *it, v, aPowerMap.weightImagePtr()->operator()( pv ) )
-                      < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            computedMA->setValue( v, aPowerMap.weightImagePtr()->operator()( pv ) );
+          for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(),
+                 itend = aPowerMap.domain().end(); it != itend; ++it)
+            {
+              const auto v  = aPowerMap( *it );
+              const auto pv = aPowerMap.projectPoint( v );
+
+              if ( aPowerMap.metricPtr()->powerDistance( *it, v, aPowerMap.weightImagePtr()->operator()( pv ) )
+                   < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
+                computedMA->setValue( v, aPowerMap.weightImagePtr()->operator()( pv ) );
+            }
+          return Type( computedMA );
         }
 
+      typedef typename TPowerMap::Domain Domain;
+      typedef typename TPowerMap::Point Point;
+      typedef typename TImageContainer::Value Value;
+      typedef Linearizer<Domain, ColMajorStorage> Linear;
+
+      const Domain & domain = aPowerMap.domain();
+      const Point extent = domain.upperBound() - domain.lowerBound() + Point::diagonal( 1 );
+      const std::size_t size = domain.size();
+      const std::size_t blockSize = 4096;
+      const std::size_t nbBlocks = ( size + blockSize - 1 ) / blockSize;
+
+      // Medial axis balls found by each thread.
+      std::vector< std::vector< std::pair<Point, Value> > > balls( aThreadPool->size() );
+      aThreadPool->parallelForWithRank( nbBlocks, [&] ( std::size_t block, unsigned int rank )
+        {
+          const std::size_t last = std::min( size, ( block + 1 ) * blockSize );
+          for ( std::size_t i = block * blockSize; i < last; ++i )
+            {
+              const Point p  = Linear::getPoint( i, domain.lowerBound(), extent );
+              const auto  v  = aPowerMap( p );
+              const auto  pv = aPowerMap.projectPoint( v );
+              const auto  w  = aPowerMap.weightImagePtr()->operator()( pv );
+
+              if ( aPowerMap.metricPtr()->powerDistance( p, v, w )
+                   < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
+                balls[ rank ].push_back( std::make_pair( v, w ) );
+            }
+        } );
+
+      for ( auto const & threadBalls : balls )
+        for ( auto const & ball : threadBalls )
+          computedMA->setValue( ball.first, ball.second );
+
       return Type( computedMA );
     }
   }; // end of class ReducedMedialAxis
@@ -123,7 +123,7 @@ namespace DGtal
                                            TPSeparableMetric,
                                            TImageContainer> Self;
 
-    typedef PowerMap<TWeightImage,TPSeparableMetric> Parent;
+    typedef PowerMap<TWeightImage,TPSeparableMetric,TImageContainer> Parent;
 
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
@@ -141,10 +141,12 @@ namespace DGtal
      */
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
-                                  ConstAlias<PowerSeparableMetric> aMetric):
+                                  ConstAlias<PowerSeparableMetric> aMetric,
+                                  ThreadPool * aThreadPool = nullptr):
       PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
                                                                aWeightImage,
-                                                               aMetric)
+                                                               aMetric,
+                                                               aThreadPool)
     {}
 
     /**
@@ -155,11 +157,13 @@ namespace DGtal
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
                                   ConstAlias<PowerSeparableMetric> aMetric,
-                                  typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                                  typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                                  ThreadPool * aThreadPool = nullptr)
       : PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
                                                                  aWeightImage,
                                                                  aMetric,
-                                                                 aPeriodicitySpec)
+                                                                 aPeriodicitySpec,
+                                                                 aThreadPool)
     {}
 
     /**
@@ -251,11 +255,11 @@ namespace DGtal
 // //                                                                           //
 // ///////////////////////////////////////////////////////////////////////////////
 
-  template <typename W,typename TSep>
+  template <typename W,typename TSep,typename TImage>
   inline
   std::ostream&
   operator<< ( std::ostream & out,
-               const ReverseDistanceTransformation<W,TSep> & object )
+               const ReverseDistanceTransformation<W,TSep,TImage> & object )
   {
     object.selfDisplay( out );
     return out;
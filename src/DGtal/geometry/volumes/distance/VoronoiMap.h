@@ -46,8 +46,10 @@
 #include <iostream>
 #include <vector>
 #include <array>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -60,6 +62,52 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Detects separable metrics providing partialRawDistances and
+     * hiddenByPartial (e.g. ExactPredicateLpSeparableMetric for
+     * p=2), used by VoronoiMap to compute the partial distances of
+     * the sites of a line once.
+     *
+     * @tparam TMetric a model of concepts::CSeparableMetric
+     */
+    template <typename TMetric>
+    struct HasPartialHiddenBy
+    {
+      typedef typename TMetric::Point Point;
+      typedef typename TMetric::RawValue RawValue;
+      typedef typename Point::Coordinate Abscissa;
+
+      template <typename M>
+      static auto test( int ) -> decltype(
+        std::declval<const M &>().partialRawDistances( (const Point *) nullptr, std::size_t(0),
+                                                       std::declval<const Point &>(), 0,
+                                                       (RawValue *) nullptr ),
+        std::declval<const M &>().hiddenByPartial( Abscissa(), RawValue(), Abscissa(), RawValue(),
+                                                   Abscissa(), RawValue() ),
+        std::true_type() );
+
+      template <typename M>
+      static std::false_type test( ... );
+
+      static const bool value = decltype( test<TMetric>( 0 ) )::value;
+    };
+  }
+
+  /**
+   * Engines solving the 1D problems of VoronoiMap with a ThreadPool,
+   * along dimensions other than the first one (along dimension 0,
+   * lines are contiguous in the image and both engines process blocks
+   * of consecutive lines):
+   *
+   * - VoronoiMapBlocks: blocks of adjacent lines, each line being
+   *   processed in place (strided accesses to the image).
+   * - VoronoiMapTiles: tiles of lines adjacent along dimension 0,
+   *   transposed into a buffer where each line is contiguous.
+   */
+  enum VoronoiMapEngine { VoronoiMapBlocks = 0, VoronoiMapTiles = 1 };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class VoronoiMap
   /**
@@ -102,6 +150,19 @@ namespace DGtal
    * in an optimal way: on @a p processors, expected runtime is in
    * @f$ O(h.d.n^d / p)@f$.
    *
+   * Independently of OpenMP, a ThreadPool can be given to the
+   * constructor. In that case, the 1D problems of each dimension are
+   * grouped into blocks of adjacent lines (whose memory footprint fits
+   * in a L2 cache) and the blocks are processed by the threads of the
+   * pool. Starting points of the lines are computed on the fly from
+   * the block index, so no list of starting points is built. By
+   * default (VoronoiMapTiles), along dimensions other than the first
+   * one, blocks are tiles of lines that are transposed into a
+   * contiguous buffer before being processed, which avoids strided
+   * accesses to the image (this engine is also worth using
+   * sequentially, with a pool of size 1). VoronoiMapBlocks processes
+   * the lines in place instead (see VoronoiMapEngine).
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -204,10 +265,20 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aThreadPool if not null, a pointer to the thread pool
+     * used to solve the 1D problems in parallel (otherwise the
+     * computation is sequential, or uses OpenMP if DGtal has been
+     * built with the WITH_OPENMP flag). The pool is only used during
+     * the construction.
+     *
+     * @param anEngine the engine used with @a aThreadPool.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               ThreadPool * aThreadPool = nullptr,
+               VoronoiMapEngine anEngine = VoronoiMapTiles);
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +303,19 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param aThreadPool if not null, a pointer to the thread pool
+     * used to solve the 1D problems in parallel. The pool is only
+     * used during the construction.
+     *
+     * @param anEngine the engine used with @a aThreadPool.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               ThreadPool * aThreadPool = nullptr,
+               VoronoiMapEngine anEngine = VoronoiMapTiles);
     /**
      * Default destructor
      */
@@ -247,6 +326,39 @@ namespace DGtal
      */
      VoronoiMap() = delete;
 
+  protected:
+
+    /**
+     * Constructor for partial computations, used by variants of the
+     * algorithm that process the domain piece by piece (see
+     * OutOfCoreDistanceTransformation).
+     *
+     * If @a predicate is not null, the sites are initialized from it
+     * (as in the other constructors), otherwise @a anImage must
+     * already contain the Voronoi map valid up to dimension @a
+     * aFirstDim - 1 (with the infinity value for points without site).
+     * Only dimensions in [@a aFirstDim, @a aLastDim) are processed.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     * @param predicate a pointer to the point predicate, or nullptr.
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aPeriodicitySpec the periodicity specification.
+     * @param anImage the image storing the map (domain @a aDomain).
+     * @param aFirstDim first dimension to process.
+     * @param aLastDim dimension after the last dimension to process.
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     */
+    VoronoiMap(ConstAlias<Domain> aDomain,
+               const PointPredicate * predicate,
+               ConstAlias<SeparableMetric> aMetric,
+               PeriodicitySpec const & aPeriodicitySpec,
+               CountedPtr<OutputImage> anImage,
+               const Dimension aFirstDim,
+               const Dimension aLastDim,
+               ThreadPool * aThreadPool = nullptr);
+
   public:
     // ------------------- ConstImage model ------------------------
 
@@ -333,16 +445,26 @@ namespace DGtal
      */
     void selfDisplay ( std::ostream & out ) const;
 
-    // ------------------- Private functions ------------------------
-  private:
+    // ------------------- Protected functions ------------------------
+  protected:
 
     /**
      * Compute the Voronoi Map of a set of point sites using a
      * SeparableMetric metric.  The method associates to each point
      * satisfying the foreground predicate, the closest site for which
      * the predicate is false. This algorithm is O(h.d.|domain size|).
+     *
+     * The sites are initialized from the predicate only if the
+     * predicate pointer is not null.
+     *
+     * @param aThreadPool if not null, the thread pool used for the
+     * 1D problems.
+     * @param aFirstDim first dimension to process.
+     * @param aLastDim dimension after the last dimension to process.
      */
-    void compute ( ) ;
+    void compute ( ThreadPool * aThreadPool,
+                   const Dimension aFirstDim = 0,
+                   const Dimension aLastDim = TSpace::dimension ) ;
 
 
     /**
@@ -351,6 +473,23 @@ namespace DGtal
      * @param [in] dim the dimension to process
      */
     void computeOtherSteps(const Dimension dim) const;
+
+    /**
+     *  Compute the other steps of the separable Voronoi map using
+     *  the threads of @a aThreadPool. Lines along dimension @a dim
+     *  are grouped into blocks of adjacent lines, each block being a
+     *  task of the pool. With the VoronoiMapTiles engine and when @a
+     *  dim is not 0, a block is a tile of lines adjacent along
+     *  dimension 0: it is copied into a transposed buffer in which
+     *  each line is contiguous, the 1D problems are solved in this
+     *  buffer, and the tile is copied back. Both copies access the
+     *  image contiguously.
+     *
+     * @param [in] dim the dimension to process
+     * @param [in] aThreadPool the thread pool.
+     */
+    void computeOtherStepsInParallel(const Dimension dim,
+                                     ThreadPool & aThreadPool) const;
     /**
      * Given  a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
@@ -363,6 +502,67 @@ namespace DGtal
     void computeOtherStep1D (const Point &row,
                              const Dimension dim) const;
 
+    /**
+     * Same as computeOtherStep1D(const Point &, const Dimension) but
+     * the sites along the 1D span are read and written through the
+     * given functors, which allows the 1D problem to be solved on a
+     * copy of the span (see computeOtherStepsInParallel).
+     *
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param [in] aGetSite functor returning the site stored at a point of the span.
+     * @param [in] aSetSite functor storing a site at a point of the span.
+     */
+    template <typename TSiteGetter, typename TSiteSetter>
+    void computeOtherStep1D (const Point &row,
+                             const Dimension dim,
+                             TSiteGetter && aGetSite,
+                             TSiteSetter && aSetSite) const;
+
+    /**
+     * Pushes into @a Sites the sites of the span of
+     * computeOtherStep1D that are not hidden, using the hiddenBy
+     * predicate of the metric.
+     *
+     * @param [in] startingPoint starting point of the 1D process.
+     * @param [in] startPoint first point of the cycle.
+     * @param [in] endPoint last point of the cycle.
+     * @param [in] dim dimension of the update.
+     * @param [in] aGetSite functor returning the site stored at a point of the span.
+     * @param [out] Sites the stack of sites.
+     */
+    template <typename TSiteGetter>
+    void pruneSites (const Point &startingPoint,
+                     const Point &startPoint,
+                     const Point &endPoint,
+                     const Dimension dim,
+                     TSiteGetter && aGetSite,
+                     std::vector<Point> & Sites,
+                     std::false_type) const;
+
+    /**
+     * Same as the previous pruneSites but, for metrics providing
+     * partialRawDistances and hiddenByPartial (see
+     * detail::HasPartialHiddenBy), the sites of the span are first
+     * collected, their partial distances are computed in a single
+     * batch, and the pruning only uses the coordinates along @a dim.
+     *
+     * @param [in] startingPoint starting point of the 1D process.
+     * @param [in] startPoint first point of the cycle.
+     * @param [in] endPoint last point of the cycle.
+     * @param [in] dim dimension of the update.
+     * @param [in] aGetSite functor returning the site stored at a point of the span.
+     * @param [out] Sites the stack of sites.
+     */
+    template <typename TSiteGetter>
+    void pruneSites (const Point &startingPoint,
+                     const Point &startPoint,
+                     const Point &endPoint,
+                     const Dimension dim,
+                     TSiteGetter && aGetSite,
+                     std::vector<Point> & Sites,
+                     std::true_type) const;
+
     /**
      * Project a coordinate into the domain, taking into account
      * the periodicity.
@@ -400,6 +600,9 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Engine used with a thread pool.
+    VoronoiMapEngine myEngine;
+
   protected:
 
     ///Pointer to the separable metric instance
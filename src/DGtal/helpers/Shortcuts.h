@@ -40,12 +40,14 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <tuple>
 #include <iterator>
+#include <map>
 #include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
@@ -79,6 +81,8 @@
 #include "DGtal/io/readers/GenericReader.h"
 #include "DGtal/io/writers/GenericWriter.h"
 #include "DGtal/io/writers/MeshWriter.h"
+#include "DGtal/io/readers/PLYReader.h"
+#include "DGtal/io/writers/PLYWriter.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/DepthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
@@ -1315,7 +1319,14 @@ namespace DGtal
             ( new ExplicitSurfaceContainer( K, surfAdj, surfels ) );
           CountedPtr<IdxDigitalSurface> ptrSurface
             ( new IdxDigitalSurface() );
-          bool ok = ptrSurface->build( ptrSurfContainer );
+          // The direct build needs sorted surfels. They are already
+          // sorted when KSpace::SurfelSet is ordered (e.g. std::set),
+          // but not when it is hashed (e.g. HashedKhalimskySpaceND).
+          std::vector< SCell > sorted_surfels( ptrSurfContainer->begin(),
+                                               ptrSurfContainer->end() );
+          if ( ! std::is_sorted( sorted_surfels.cbegin(), sorted_surfels.cend() ) )
+            std::sort( sorted_surfels.begin(), sorted_surfels.end() );
+          bool ok = ptrSurface->build( ptrSurfContainer, std::move( sorted_surfels ) );
           if ( !ok )
             trace.warning() << "[Shortcuts::makeIdxDigitalSurface]"
                             << " Error building indexed digital surface." << std::endl;
@@ -1378,6 +1389,111 @@ namespace DGtal
         return makeIdxDigitalSurface( surfels, K, params );
       }    
 
+      /// Builds an indexed digital surface from a binary PLY file
+      /// written by savePLY. The surfels are rebuilt from the face
+      /// properties kx, ky, kz (Khalimsky coordinates) and sign, so
+      /// that the pointel positions are ignored.
+      ///
+      /// @param[in] plyfile the input filename.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the saved surfels.
+      ///
+      /// @param[out] surfelAttributes if not null, the other face
+      /// properties of the file, reordered as the vertices of the
+      /// returned surface.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///
+      /// @return a smart pointer on the indexed digital surface built
+      /// over the surfels, or a null pointer if the file has no surfel.
+      /// @throw IOException if the file cannot be read or is not a
+      /// binary little-endian PLY file.
+      static CountedPtr<IdxDigitalSurface>
+        makeIdxDigitalSurfaceFromPLY
+        ( std::string          plyfile,
+          ConstAlias< KSpace > K,
+          PLYAttributes*       surfelAttributes = nullptr,
+          const Parameters&    params = parametersDigitalSurface() )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        const KSpace&        aK = K;
+        PLYReader            ply( plyfile );
+        std::vector< Point > kcoords;
+        std::vector< int >   signs;
+        if ( ! ply.readVectors( "face", "k", kcoords )
+             || ! ply.readProperty( "face", "sign", signs ) )
+          {
+            trace.warning() << "[Shortcuts::makeIdxDigitalSurfaceFromPLY]"
+                            << " No surfels in " << plyfile << std::endl;
+            return CountedPtr<IdxDigitalSurface>( 0 );
+          }
+        SurfelRange surfels( kcoords.size() );
+        for ( std::size_t i = 0; i < kcoords.size(); ++i )
+          surfels[ i ] = aK.sCell( kcoords[ i ], signs[ i ] != 0 ? KSpace::POS : KSpace::NEG );
+        auto surface = makeIdxDigitalSurface( SurfelSet( surfels.begin(), surfels.end() ),
+                                              aK, params );
+        if ( surfelAttributes != nullptr )
+          {
+            PLYAttributes attributes;
+            ply.readAttributes( "face", attributes,
+                                { "kx", "ky", "kz", "sign" } );
+            for ( auto& attribute : attributes.map() )
+              {
+                std::vector< double > values( surface->nbVertices() );
+                for ( std::size_t i = 0; i < surfels.size(); ++i )
+                  values[ surface->getVertex( surfels[ i ] ) ] = attribute.second[ i ];
+                surfelAttributes->setScalars( attribute.first, values );
+              }
+          }
+        return surface;
+      }
+
+      /// Builds the indexed digital surfaces separating the regions of
+      /// a label image, one for each pair of labels in contact. The
+      /// image is scanned once (see Surfaces::sMakeLabelBoundaries)
+      /// instead of once per label with makeBinaryImage. The surface
+      /// of labels (a,b), with a < b, is oriented as the boundary of
+      /// the region of label a, and its container is a SetOfSurfels.
+      ///
+      /// @tparam TLabel the type of labels (e.g. unsigned char, int).
+      ///
+      /// @param[in] labels a label image.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the image domain.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///
+      /// @return a map associating to each pair of labels in contact
+      /// the indexed digital surface between them.
+      template <typename TLabel>
+        static std::map< std::pair< TLabel, TLabel >, CountedPtr<IdxDigitalSurface> >
+        makeLabelIdxDigitalSurfaces
+        ( CountedPtr< ImageContainerBySTLVector< Domain, TLabel > > labels,
+          const KSpace&        K,
+          const Parameters&    params = parametersDigitalSurface() )
+        {
+          bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
+          SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
+          std::map< std::pair< TLabel, TLabel >, std::vector< SCell > > boundaries;
+          Surfaces<KSpace>::sMakeLabelBoundaries( boundaries, K, *labels );
+          std::map< std::pair< TLabel, TLabel >, CountedPtr<IdxDigitalSurface> > surfaces;
+          for ( auto & b : boundaries )
+            {
+              CountedPtr<ExplicitSurfaceContainer> ptrSurfContainer
+                ( new ExplicitSurfaceContainer
+                  ( K, surfAdj, SurfelSet( b.second.begin(), b.second.end() ) ) );
+              CountedPtr<IdxDigitalSurface> ptrSurface( new IdxDigitalSurface() );
+              if ( ! ptrSurface->build( ptrSurfContainer, std::move( b.second ) ) )
+                trace.warning() << "[Shortcuts::makeLabelIdxDigitalSurfaces]"
+                                << " Error building indexed digital surface between labels "
+                                << b.first.first << " and " << b.first.second << std::endl;
+              surfaces[ b.first ] = ptrSurface;
+            }
+          return surfaces;
+        }
+
     
       /// Given any digital surface, returns the vector of its k-dimensional cells.
       ///
@@ -1653,6 +1769,93 @@ namespace DGtal
         else return surface->allVertices();
         return result;
       }
+      /// Outputs an indexed digital surface as a binary little-endian
+      /// PLY file (see PLYWriter), which is memory-mapped and read
+      /// back without parsing by makeIdxDigitalSurfaceFromPLY. The
+      /// vertices are the pointels (canonic embedding). The faces are
+      /// the surfels, in the order of the vertices of \a surface, with
+      /// their pointels (vertex_indices), their Khalimsky coordinates
+      /// (int kx, ky, kz), their sign (uchar sign) and the given
+      /// attributes.
+      ///
+      /// @code
+      /// PLYAttributes attributes;
+      /// attributes.setVectors( "n", normals );  // nx, ny, nz
+      /// attributes.setScalars( "H", curvatures );
+      /// SH3::savePLY( surface, "surface.ply", attributes );
+      /// @endcode
+      ///
+      /// @param[in] surface the indexed digital surface to output.
+      /// @param[in] plyfile the output filename.
+      /// @param[in] surfelAttributes some scalar values per surfel,
+      /// given in the order of the vertices of \a surface (e.g. the
+      /// normals or curvatures computed by ShortcutsGeometry on the
+      /// surfels surface->surfel( v ), v = 0, 1, ...).
+      /// @return 'true' if the output stream is good, 'false' otherwise
+      /// or if some attribute has not one value per surfel.
+      static bool
+      savePLY
+      ( CountedPtr<IdxDigitalSurface> surface,
+        std::string                   plyfile,
+        const PLYAttributes&          surfelAttributes = PLYAttributes() )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        const KSpace& K = refKSpace( surface );
+        const Idx     n = surface->nbVertices();
+        for ( const auto& attribute : surfelAttributes.map() )
+          if ( attribute.second.size() != n )
+            {
+              trace.error() << "[Shortcuts::savePLY] attribute " << attribute.first
+                            << " has " << attribute.second.size()
+                            << " values instead of " << n << std::endl;
+              return false;
+            }
+        // Number the pointels in the order of the surfels.
+        Cell2Index   c2i;
+        PointelRange pointels;
+        std::vector< PointelRange > faces( n );
+        for ( Idx v = 0; v < n; ++v )
+          {
+            faces[ v ] = getPointelRange( K, surface->surfel( v ) );
+            for ( auto&& pointel : faces[ v ] )
+              if ( c2i.insert( std::make_pair( pointel, (Idx) pointels.size() ) ).second )
+                pointels.push_back( pointel );
+          }
+        std::ofstream output( plyfile.c_str(), std::ios::out | std::ios::binary );
+        PLYWriter ply( output );
+        ply.addComment( "Generated from DGtal::Shortcuts from the DGTal library" );
+        ply.addElement( "vertex", pointels.size() );
+        ply.addProperty( "x", "double" );
+        ply.addProperty( "y", "double" );
+        ply.addProperty( "z", "double" );
+        ply.addElement( "face", n );
+        ply.addListProperty( "vertex_indices", "uchar", "uint" );
+        ply.addProperty( "kx", "int" );
+        ply.addProperty( "ky", "int" );
+        ply.addProperty( "kz", "int" );
+        ply.addProperty( "sign", "uchar" );
+        ply.addAttributes( surfelAttributes );
+        ply.writeHeader();
+        auto embedder = getCellEmbedder( K );
+        for ( auto&& pointel : pointels )
+          {
+            const RealPoint p = embedder( pointel );
+            for ( Dimension k = 0; k < 3; ++k ) ply.put( (double) p[ k ] );
+          }
+        for ( Idx v = 0; v < n; ++v )
+          {
+            const SCell& surfel = surface->surfel( v );
+            ply.put( (DGtal::uint8_t) faces[ v ].size() );
+            for ( auto&& pointel : faces[ v ] )
+              ply.put( (DGtal::uint32_t) c2i[ pointel ] );
+            const Point kp = K.sKCoords( surfel );
+            for ( Dimension k = 0; k < 3; ++k ) ply.put( (DGtal::int32_t) kp[ k ] );
+            ply.put( (DGtal::uint8_t) ( K.sSign( surfel ) == KSpace::POS ? 1 : 0 ) );
+            ply.putAttributes( surfelAttributes, v );
+          }
+        return ply.flush();
+      }
+
       /// Outputs a digital surface as an OFF file (with its
       /// topology).  Optionnaly you can specify the face colors (see
       /// saveOBJ for a more advanced export).
@@ -39,6 +39,7 @@
 #define ShortcutsGeometry_h
 
 //////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/helpers/Shortcuts.h"
 #include "DGtal/geometry/volumes/distance/LpMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -48,6 +49,9 @@
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#if defined(WITH_FFTW3_DOUBLE)
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTEstimator.h"
+#endif // defined(WITH_FFTW3_DOUBLE)
 
 #if defined(WITH_EIGEN)
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
@@ -641,6 +645,8 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" (kernel moved along the surfels) or "fft" (whole shape convolved by FFT, requires FFTW3).
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -650,7 +656,9 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "threads",           1 )
+          ( "II-method", "convolver" );
       }
 
       /// Given a digital space \a K and a vector of \a surfels,
@@ -834,6 +842,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -869,6 +879,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -910,6 +922,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -947,12 +961,9 @@ namespace DGtal
             }
           IINormalFunctor     functor;
           functor.init( h, r*h );
-          IINormalEstimator   ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_estimations ) );
+          evalIIEstimator< IINormalEstimator >( shape, K, surfels, functor, h, r,
+                                                params,
+                                                n_estimations );
           const RealVectors n_trivial = getTrivialNormalVectors( K, surfels );
           orientVectors( n_estimations, n_trivial );
           return n_estimations;
@@ -971,6 +982,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1002,6 +1015,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1041,6 +1056,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1074,12 +1091,9 @@ namespace DGtal
             }
           IIMeanCurvFunctor   functor;
           functor.init( h, r*h );
-          IIMeanCurvEstimator ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+          evalIIEstimator< IIMeanCurvEstimator >( shape, K, surfels, functor, h, r,
+                                                  params,
+                                                  mc_estimations );
           return mc_estimations;
         }
 
@@ -1095,6 +1109,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1126,6 +1142,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1165,6 +1183,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1198,12 +1218,9 @@ namespace DGtal
             }
           IIGaussianCurvFunctor   functor;
           functor.init( h, r*h );
-          IIGaussianCurvEstimator ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+          evalIIEstimator< IIGaussianCurvEstimator >( shape, K, surfels, functor, h, r,
+                                                      params,
+                                                      mc_estimations );
           return mc_estimations;
         }
 
@@ -1220,6 +1237,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1252,6 +1271,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1291,6 +1312,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads of the II estimators, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
       ///  in the same order as \a surfels.
@@ -1323,12 +1346,9 @@ namespace DGtal
         }
         IICurvFunctor   functor;
         functor.init( h, r*h );
-        IICurvEstimator ii_estimator( functor );
-        ii_estimator.attach( K, shape );
-        ii_estimator.setParams( r );
-        ii_estimator.init( h, surfels.begin(), surfels.end() );
-        ii_estimator.eval( surfels.begin(), surfels.end(),
-                          std::back_inserter( mc_estimations ) );
+        evalIIEstimator< IICurvEstimator >( shape, K, surfels, functor, h, r,
+                                            params,
+                                            mc_estimations );
         return mc_estimations;
       }
 
@@ -1803,6 +1823,111 @@ namespace DGtal
       // ------------------------- Hidden services ------------------------------
     protected:
 
+      /// Evaluates an Integral Invariant estimator at the given
+      /// surfels. With several threads, the surfel range is cut into
+      /// contiguous chunks evaluated in parallel, each thread owning
+      /// its estimator. A chunk keeps the order of \a surfels, so that
+      /// the convolver still updates its sums incrementally from one
+      /// surfel to the next within a chunk. With the "fft" method, the
+      /// moments are computed once by IntegralInvariantFFTEstimator
+      /// and the chunks share this estimator.
+      ///
+      /// @tparam TEstimator either an IntegralInvariantVolumeEstimator or an IntegralInvariantCovarianceEstimator.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which the estimator is evaluated.
+      /// @param[in] functor the (initialized) functor of the estimator.
+      /// @param[in] h the gridstep.
+      /// @param[in] r the digital radius of the kernel.
+      /// @param[in] params the parameters:
+      ///   - threads         [     1]: the number of threads, 0 for the number of hardware threads.
+      ///   - II-method [ "convolver"]: the II estimator, either "convolver" or "fft" (requires FFTW3).
+      /// @param[out] result the estimations, in the same order as \a surfels.
+      template <typename TEstimator, typename TPointPredicate,
+                typename TFunctor, typename TQuantities>
+      static void
+      evalIIEstimator( const TPointPredicate& shape,
+                       const KSpace&          K,
+                       const SurfelRange&     surfels,
+                       const TFunctor&        functor,
+                       Scalar                 h,
+                       Scalar                 r,
+                       const Parameters&      params,
+                       TQuantities&           result )
+      {
+        // Parameters built without parametersGeometryEstimation() keep
+        // the sequential convolver.
+        const int         nbThreads = params.count( "threads" )
+          ? params[ "threads"   ].as<int>() : 1;
+        const std::string method    = params.count( "II-method" )
+          ? params[ "II-method" ].as<std::string>() : std::string( "convolver" );
+        const std::size_t nbSurfels = surfels.size();
+        if ( method == "fft" )
+          {
+#if defined(WITH_FFTW3_DOUBLE)
+            typedef IntegralInvariantFFTEstimator< KSpace, TPointPredicate, TFunctor > FFTEstimator;
+            FFTEstimator ii_estimator( functor );
+            ii_estimator.attach( K, shape );
+            ii_estimator.setParams( r );
+            ii_estimator.init( h, surfels.begin(), surfels.end() );
+            result.resize( nbSurfels );
+            if ( nbThreads == 1 || nbSurfels < 2 )
+              {
+                ii_estimator.eval( surfels.begin(), surfels.end(), result.begin() );
+                return;
+              }
+            ThreadPool pool( nbThreads > 0 ? (unsigned int) nbThreads : 0 );
+            const std::size_t nbChunks  = std::min< std::size_t >( nbSurfels, pool.size() );
+            const std::size_t chunkSize = ( nbSurfels + nbChunks - 1 ) / nbChunks;
+            pool.parallelFor
+              ( nbChunks, [&] ( std::size_t c )
+                {
+                  const std::size_t b = std::min( nbSurfels, c * chunkSize );
+                  const std::size_t e = std::min( nbSurfels, b + chunkSize );
+                  ii_estimator.eval( surfels.begin() + b, surfels.begin() + e,
+                                     result.begin() + b );
+                } );
+            return;
+#else
+            trace.warning() << "[ShortcutsGeometry::evalIIEstimator]"
+                            << " II-method \"fft\" requires FFTW3 in double precision,"
+                            << " using \"convolver\"." << std::endl;
+#endif // defined(WITH_FFTW3_DOUBLE)
+          }
+        if ( nbThreads == 1 || nbSurfels < 2 )
+          {
+            TEstimator ii_estimator( functor );
+            ii_estimator.attach( K, shape );
+            ii_estimator.setParams( r );
+            ii_estimator.init( h, surfels.begin(), surfels.end() );
+            ii_estimator.eval( surfels.begin(), surfels.end(),
+                               std::back_inserter( result ) );
+            return;
+          }
+        ThreadPool pool( nbThreads > 0 ? (unsigned int) nbThreads : 0 );
+        std::vector< CountedPtr<TEstimator> > estimators;
+        for ( unsigned int i = 0; i < pool.size(); ++i )
+          {
+            CountedPtr<TEstimator> ii_estimator( new TEstimator( functor ) );
+            ii_estimator->attach( K, shape );
+            ii_estimator->setParams( r );
+            ii_estimator->init( h, surfels.begin(), surfels.end() );
+            estimators.push_back( ii_estimator );
+          }
+        // A few chunks per thread for load balancing.
+        const std::size_t nbChunks  = std::min< std::size_t >( nbSurfels, 4 * pool.size() );
+        const std::size_t chunkSize = ( nbSurfels + nbChunks - 1 ) / nbChunks;
+        result.resize( nbSurfels );
+        pool.parallelForWithRank
+          ( nbChunks, [&] ( std::size_t c, unsigned int rank )
+            {
+              const std::size_t b = std::min( nbSurfels, c * chunkSize );
+              const std::size_t e = std::min( nbSurfels, b + chunkSize );
+              estimators[ rank ]->eval( surfels.begin() + b, surfels.begin() + e,
+                                        result.begin() + b );
+            } );
+      }
+
       // ------------------------- Internals ------------------------------------
     private:
 
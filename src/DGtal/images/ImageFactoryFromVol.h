@@ -0,0 +1,262 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromVol.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageFactoryFromVol.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromVol.h
+#else // defined(ImageFactoryFromVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromVol_RECURSES
+
+#if !defined ImageFactoryFromVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/readers/VolStreamReader.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromVol
+  /**
+   * Description of template class 'ImageFactoryFromVol' <p>
+   * \brief Aim: implements a factory to produce images from a .vol,
+   * .longvol or raw file according to a given domain, without loading
+   * the whole file.
+   *
+   * The images are read from the file with a VolStreamReader by the
+   * function 'requestImage', so that TiledImage and ImageCache page
+   * their tiles straight from the file, and the deletion must be done
+   * with the function 'detachImage'.
+   *
+   * The file is read-only: 'flushImage' does nothing, so that
+   * modified tiles are lost when they leave the cache.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * typedef ImageFactoryFromVol<Image> Factory;
+   * typedef ImageCacheReadPolicyFIFO<Image, Factory> ReadPolicy;
+   * typedef ImageCacheWritePolicyWT<Image, Factory> WritePolicy;
+   * Factory factory( "data.vol" );
+   * ReadPolicy readPolicy( factory, 16 );
+   * WritePolicy writePolicy( factory );
+   * TiledImage<Image, Factory, ReadPolicy, WritePolicy>
+   *   tiled( factory, readPolicy, writePolicy, 8 );
+   * @endcode
+   *
+   * @tparam TImageContainer an image container type (model of CImage).
+   * @tparam TWord the type of the voxel values stored in the file
+   * (see VolStreamReader).
+   * @tparam TFunctor the type of functor used to cast the words into
+   * image values.
+   */
+  template <typename TImageContainer,
+            typename TWord = unsigned char,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  class ImageFactoryFromVol
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromVol<TImageContainer, TWord, TFunctor> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef VolStreamReader<TImageContainer, TWord, TFunctor> Reader;
+    typedef typename Reader::Vector Vector;
+    typedef typename Reader::Functor Functor;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor from a .vol or a .longvol file.
+     * @param filename the file name.
+     * @param aFunctor the functor used to cast the words into image values.
+     * @throw IOException if the header is invalid.
+     */
+    ImageFactoryFromVol( const std::string & filename,
+                         const Functor & aFunctor = Functor() )
+      : myReader( filename, aFunctor )
+    {
+    }
+
+    /**
+     * Constructor from a raw file.
+     * @param filename the file name.
+     * @param extent the size of the raw data set.
+     * @param offset the position of the voxel data in the file.
+     * @param aFunctor the functor used to cast the words into image values.
+     * @throw IOException if the file cannot be read.
+     */
+    ImageFactoryFromVol( const std::string & filename, const Vector & extent,
+                         std::size_t offset = 0,
+                         const Functor & aFunctor = Functor() )
+      : myReader( filename, extent, offset, aFunctor )
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageFactoryFromVol() {}
+
+  private:
+
+    ImageFactoryFromVol( const ImageFactoryFromVol & other );
+
+    ImageFactoryFromVol & operator=( const ImageFactoryFromVol & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myReader.domain();
+    }
+
+    /////////////////// Accessors //////////////////
+
+    /**
+     * @return a reference to the reader of the file.
+     */
+    Reader & reader()
+    {
+      return myReader;
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myReader.isValid();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain and read from the file.
+     *
+     * @param aDomain the domain, included in domain().
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain)
+    {
+      return new OutputImage( myReader.readSubDomain( aDomain ) );
+    }
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage: does nothing
+     * since the file is read-only.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage(OutputImage* outputImage)
+    {
+      boost::ignore_unused_variable_warning( outputImage );
+    }
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage)
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  protected:
+
+    /// The reader of the file.
+    Reader myReader;
+
+  }; // end of class ImageFactoryFromVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TWord, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageFactoryFromVol<TImageContainer, TWord, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromVol_h
+
+#undef ImageFactoryFromVol_RECURSES
+#endif // else defined(ImageFactoryFromVol_RECURSES)
@@ -109,7 +109,7 @@ namespace DGtal
 
     /**
      * Constructor.
-     * @param anImageFactory alias on the image factory (see ImageFactoryFromImage or ImageFactoryFromHDF5).
+     * @param anImageFactory alias on the image factory (see ImageFactoryFromImage, ImageFactoryFromHDF5 or ImageFactoryFromVol).
      * @param aReadPolicy alias on a read policy.
      * @param aWritePolicy alias on a write policy.
      * @param N how many tiles we want for each dimension.
@@ -0,0 +1,160 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MappedFile.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MappedFile_RECURSES)
+#error Recursive header files inclusion detected in MappedFile.h
+#else // defined(MappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MappedFile_RECURSES
+
+#if !defined MappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define MappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MappedFile
+  /**
+   * Description of class 'MappedFile' <p>
+   * \brief Aim: gives a read-only access to the bytes of a file, from
+   * a given offset to its end, as a contiguous array.
+   *
+   * The file is memory-mapped when possible (not on WIN32), so that
+   * its bytes are read on demand without any copy. Otherwise, the
+   * bytes are read in memory with a single fread. Readers may thus
+   * parse files in place whatever their format, e.g. VolPayloadReader
+   * (Vol payloads), MeshTextParser (OBJ and OFF files) and PLYReader.
+   *
+   * @code
+   * MappedFile file( filename );
+   * for ( const char * p = file.data(); p != file.data() + file.size(); ++p )
+   *   ... // process the byte *p.
+   * @endcode
+   */
+  class MappedFile
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps or reads the file.
+     * @param filename the file name.
+     * @param offset the position of the first accessed byte in the file.
+     * @throw IOException if the file cannot be read or is shorter
+     * than @a offset.
+     */
+    MappedFile( const std::string & filename, std::size_t offset = 0 );
+
+    /**
+     * Destructor, unmaps the file.
+     */
+    ~MappedFile();
+
+    /// Copy constructor (deleted).
+    MappedFile( const MappedFile & other ) = delete;
+
+    /// Assignment (deleted).
+    MappedFile & operator= ( const MappedFile & other ) = delete;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the first accessed byte of the file.
+    const char * data() const;
+
+    /// @return the number of bytes from the offset to the end of the file.
+    std::size_t size() const;
+
+    /// @return true if the file is memory-mapped.
+    bool isMapped() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The mapped file (nullptr if not mapped).
+    void * myMapping;
+    /// The size of the mapped file.
+    std::size_t myMappingSize;
+    /// The bytes read in memory when the file is not mapped.
+    std::vector<char> myFileData;
+    /// The first accessed byte.
+    const char * myData;
+    /// The number of accessed bytes.
+    std::size_t mySize;
+
+  }; // end of class MappedFile
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MappedFile & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/MappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MappedFile_h
+
+#undef MappedFile_RECURSES
+#endif // else defined(MappedFile_RECURSES)
@@ -0,0 +1,180 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PLYAttributes.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PLYAttributes.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PLYAttributes_RECURSES)
+#error Recursive header files inclusion detected in PLYAttributes.h
+#else // defined(PLYAttributes_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PLYAttributes_RECURSES
+
+#if !defined PLYAttributes_h
+/** Prevents repeated inclusion of headers. */
+#define PLYAttributes_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class PLYAttributes
+  /**
+   * Description of class 'PLYAttributes' <p>
+   * \brief Aim: named arrays of values attached to the vertices or to
+   * the faces of a mesh (e.g. curvatures, principal directions), as
+   * written to and read from PLY files (see PLYWriter, PLYReader).
+   *
+   * Each attribute is a scalar array, stored as a PLY property of type
+   * double. A vector attribute of name @a name (e.g. a vector field
+   * given by ShortcutsGeometry) is stored as the three scalar arrays
+   * @a name + "x", @a name + "y" and @a name + "z", following the PLY
+   * convention of normals (nx, ny, nz).
+   *
+   * @code
+   * PLYAttributes attributes;
+   * attributes.setScalars( "k1", k1 );      // e.g. ShortcutsGeometry::getFirstPrincipalCurvatures
+   * attributes.setVectors( "d1", d1 );      // e.g. ShortcutsGeometry::getFirstPrincipalDirections
+   * ...
+   * std::vector< Z3i::RealVector > d1_read = attributes.vectors< Z3i::RealVector >( "d1" );
+   * @endcode
+   */
+  class PLYAttributes
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    /// The map associating names to scalar arrays.
+    typedef std::map< std::string, std::vector< double > > Map;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Sets a scalar attribute.
+     * @param name the name of the attribute.
+     * @param values the values of the attribute, one per element.
+     */
+    void setScalars( const std::string & name, const std::vector< double > & values );
+
+    /**
+     * Sets a vector attribute, stored as the three scalar attributes
+     * @a name + "x", @a name + "y" and @a name + "z".
+     * @param name the name of the attribute.
+     * @param values the vectors of the attribute, one per element.
+     * @tparam TRealVector any model of 3D real vector.
+     */
+    template <typename TRealVector>
+    void setVectors( const std::string & name, const std::vector< TRealVector > & values );
+
+    /// @param name the name of an attribute.
+    /// @return true if the scalar attribute @a name exists.
+    bool hasScalars( const std::string & name ) const;
+
+    /// @param name the name of an attribute.
+    /// @return true if the vector attribute @a name exists.
+    bool hasVectors( const std::string & name ) const;
+
+    /// @param name the name of an attribute.
+    /// @return the values of the scalar attribute @a name (empty if it
+    /// does not exist).
+    const std::vector< double > & scalars( const std::string & name ) const;
+
+    /**
+     * @param name the name of an attribute.
+     * @return the vectors of the vector attribute @a name (empty if it
+     * does not exist).
+     * @tparam TRealVector any model of 3D real vector.
+     */
+    template <typename TRealVector>
+    std::vector< TRealVector > vectors( const std::string & name ) const;
+
+    /// @return the map of all scalar attributes.
+    const Map & map() const;
+
+    /// @return the map of all scalar attributes.
+    Map & map();
+
+    /// @return true if there is no attribute.
+    bool empty() const;
+
+    /// Removes all attributes.
+    void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if all the attributes have the same size.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The scalar attributes.
+    Map myScalars;
+
+  }; // end of class PLYAttributes
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PLYAttributes'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PLYAttributes' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PLYAttributes & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/PLYAttributes.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PLYAttributes_h
+
+#undef PLYAttributes_RECURSES
+#endif // else defined(PLYAttributes_RECURSES)
@@ -48,6 +48,9 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/io/readers/VolPayloadReader.h"
+#include <type_traits>
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -110,38 +113,69 @@ namespace DGtal
      * default set to functors::Cast < TImageContainer::Value > .
      *
      *@return an instance of the ImageContainer.
+     *
+     * The voxel data is read (memory-mapped when possible) and
+     * inflated by blocks with VolPayloadReader. When ImageContainer is
+     * an ImageContainerBySTLVector, the functor is applied block by
+     * block directly into the image buffer, otherwise values are set
+     * point by point.
+     *
+     * Chunked files (Version 4, see LongvolWriter::exportChunkedLongvol)
+     * are inflated block by block, in parallel when @a aThreadPool is
+     * given and ImageContainer is an ImageContainerBySTLVector.
+     *
+     * @param aThreadPool if not null, the thread pool used to inflate
+     * the blocks of chunked files.
      */
     static ImageContainer importLongvol(const std::string & filename,
-                                        const Functor & aFunctor =  Functor());
+                                        const Functor & aFunctor =  Functor(),
+                                        ThreadPool * aThreadPool = nullptr);
     
     
     
   private:
     
     /**
-     * Generic read word (binary mode) in little-endian mode.
-     *
-     * @param fin input stream.
-     * @param aValue value to write.
-     *
-     * @return modified stream.
+     * Decodes a little-endian 64-bit word.
+     * @param bytes the 8 bytes of the word.
+     * @return the word.
      */
-    template <typename Word>
-    static
-    std::stringstream& read_word( std::stringstream & fin, Word& aValue )
+    static DGtal::uint64_t decodeWord( const unsigned char * bytes )
     {
-      aValue = 0;
-      char c;
-      for (unsigned int size = 0; size < sizeof( Word ); ++size)
-      {
-        fin.get( c ) ;
-        unsigned char cc=static_cast<unsigned char>(c);
-        aValue |= (cc << (8 * size));
-      }
-      return fin;
+      DGtal::uint64_t aValue = 0;
+      for ( unsigned int size = 0; size < sizeof( DGtal::uint64_t ); ++size )
+        aValue |= static_cast<DGtal::uint64_t>( bytes[ size ] ) << ( 8 * size );
+      return aValue;
     }
-    
-    
+
+    /**
+     * Reads @a total voxels of the payload into @a image, block by
+     * block into the image buffer.
+     * @param image the image, of @a total points.
+     * @param payload the payload of the file.
+     * @param aFunctor the functor used to cast the values.
+     * @param total the number of voxels.
+     * @param aThreadPool if not null, the thread pool used to inflate
+     * the blocks of a chunked payload.
+     * @return the number of voxels read.
+     */
+    static std::size_t readPayload( ImageContainer & image, VolPayloadReader & payload,
+                                    const Functor & aFunctor, std::size_t total,
+                                    ThreadPool * aThreadPool, std::true_type );
+
+    /**
+     * Reads @a total voxels of the payload into @a image, point by point.
+     * @param image the image, of @a total points.
+     * @param payload the payload of the file.
+     * @param aFunctor the functor used to cast the values.
+     * @param total the number of voxels.
+     * @param aThreadPool unused.
+     * @return the number of voxels read.
+     */
+    static std::size_t readPayload( ImageContainer & image, VolPayloadReader & payload,
+                                    const Functor & aFunctor, std::size_t total,
+                                    ThreadPool * aThreadPool, std::false_type );
+
     typedef unsigned char voxel;
     /** This class help us to associate a field type and his value.
      * An object is a pair (type, value). You can copy and assign
@@ -43,6 +43,9 @@
 #include <iostream>
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/io/readers/MeshTextParser.h"
+#include "DGtal/io/readers/PLYReader.h"
 #include "DGtal/shapes/Mesh.h"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -57,7 +60,7 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
+ * OFF, OFS and PLY surface mesh. It allows to import a Mesh object and takes
  * into accouts the optional color faces.
  * 
  * The importation can be done automatically according the input file
@@ -105,13 +108,39 @@ public:
   * @param filename the file name to import.
   * @param aMesh (return) the mesh object to be imported.
   * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @param aThreadPool if not null, the vertex and face lines are parsed in parallel by the threads of this pool. 
   * @return an instance of the imported mesh: MeshFromPoint.
+  *
+  * The file is memory-mapped and parsed in place (see
+  * MeshTextParser). The parallel parsing expects each vertex and
+  * each face on its own line (as written by MeshWriter), and falls
+  * back to the sequential parsing otherwise.
   */
   
   static  bool  importOFFFile(const std::string & filename, 
-			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false,
+			      ThreadPool * aThreadPool=nullptr);
+  
+
   
 
+ /** 
+  * Main method to import binary little-endian PLY meshes file (see
+  * PLYReader). The vertices are read from the properties x, y, z of
+  * the vertex element, the faces from the list property
+  * vertex_indices (or vertex_index) of the face element, and the face
+  * colors from the properties red, green, blue (and alpha) if they
+  * exist.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the file contains vertices.
+  * @throw IOException if the file cannot be read or is not a binary little-endian PLY file.
+  */
+  
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
   
 
  /** 
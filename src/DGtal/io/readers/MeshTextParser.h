@@ -0,0 +1,188 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshTextParser.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MeshTextParser.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshTextParser_RECURSES)
+#error Recursive header files inclusion detected in MeshTextParser.h
+#else // defined(MeshTextParser_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshTextParser_RECURSES
+
+#if !defined MeshTextParser_h
+/** Prevents repeated inclusion of headers. */
+#define MeshTextParser_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/MappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct MeshTextParser
+  /**
+   * Description of struct 'MeshTextParser' <p>
+   * \brief Aim: low-level services to parse text mesh files (OBJ, OFF)
+   * directly from memory, without iostreams.
+   *
+   * The file is memory-mapped (see MappedFile) and parsed in
+   * place: the numbers are parsed by hand, with the same results as
+   * std::strtod (the few numbers that cannot be converted exactly with
+   * double arithmetic are given to std::strtod). The text can also be
+   * split into ranges of whole lines, parsed in parallel.
+   *
+   * The parsing functions take a position @a p in the text, which
+   * they advance past the parsed characters, and the end @a end of the
+   * text (which is not NUL-terminated).
+   *
+   * Used by SurfaceMeshReader::readOBJ and MeshReader::importOFFFile.
+   *
+   * @code
+   * MeshTextParser::File file( "mesh.obj" );
+   * for ( const char * p = file.begin(); p != file.end();
+   *       p = MeshTextParser::nextLine( p, file.end() ) )
+   *   ... // parse a line.
+   * @endcode
+   */
+  struct MeshTextParser
+  {
+    /**
+     * A text file mapped in memory.
+     */
+    class File
+    {
+    public:
+      /**
+       * Constructor. Maps the file in memory.
+       * @param filename the file name.
+       * @throw IOException if the file cannot be read.
+       */
+      File( const std::string & filename );
+
+      /// @return the first character of the file.
+      const char * begin() const;
+      /// @return the character after the last character of the file.
+      const char * end() const;
+
+    private:
+      /// The file content.
+      MappedFile myFile;
+    };
+
+    /// @return true if @a c is a blank character (space, tabulation,
+    /// carriage return, but not a line feed).
+    static bool isBlank( char c );
+
+    /**
+     * @param p a position in the text.
+     * @param end the end of the text.
+     * @return the first position from @a p which is not a blank
+     * character (line feeds are not skipped).
+     */
+    static const char * skipBlanks( const char * p, const char * end );
+
+    /**
+     * @param p a position in the text.
+     * @param end the end of the text.
+     * @return the first position from @a p which is not a white space
+     * character (line feeds are skipped, as std::operator>> does).
+     */
+    static const char * skipSpaces( const char * p, const char * end );
+
+    /**
+     * @param p a position in the text.
+     * @param end the end of the text.
+     * @return the line feed ending the line of @a p, or @a end.
+     */
+    static const char * endOfLine( const char * p, const char * end );
+
+    /**
+     * @param p a position in the text.
+     * @param end the end of the text.
+     * @return the beginning of the line following the line of @a p,
+     * or @a end.
+     */
+    static const char * nextLine( const char * p, const char * end );
+
+    /**
+     * Parses a real number (same syntax as std::strtod, without
+     * hexadecimal numbers).
+     *
+     * @param[in,out] p the position of the number, advanced past it
+     * when it is parsed.
+     * @param end the end of the text.
+     * @param[out] x the parsed number.
+     * @return true if a number has been parsed.
+     */
+    static bool parseReal( const char * & p, const char * end, double & x );
+
+    /**
+     * Parses a decimal integer, with an optional sign.
+     *
+     * @param[in,out] p the position of the number, advanced past it
+     * when it is parsed.
+     * @param end the end of the text.
+     * @param[out] x the parsed number.
+     * @return true if a number has been parsed.
+     */
+    static bool parseInteger( const char * & p, const char * end, long & x );
+
+    /**
+     * Splits a text into ranges of whole lines of similar sizes.
+     *
+     * @param begin the beginning of the text.
+     * @param end the end of the text.
+     * @param nb the number of ranges.
+     * @return the @a nb + 1 bounds of the ranges, the first one being
+     * @a begin and the last one @a end. Each other bound is the
+     * beginning of a line (some ranges may be empty).
+     */
+    static std::vector< const char * > splitLines( const char * begin, const char * end,
+                                                  std::size_t nb );
+
+  }; // end of struct MeshTextParser
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/MeshTextParser.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshTextParser_h
+
+#undef MeshTextParser_RECURSES
+#endif // else defined(MeshTextParser_RECURSES)
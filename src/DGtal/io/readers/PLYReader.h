@@ -0,0 +1,313 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PLYReader.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PLYReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PLYReader_RECURSES)
+#error Recursive header files inclusion detected in PLYReader.h
+#else // defined(PLYReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PLYReader_RECURSES
+
+#if !defined PLYReader_h
+/** Prevents repeated inclusion of headers. */
+#define PLYReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/PLYAttributes.h"
+#include "DGtal/io/MappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class PLYReader
+  /**
+   * Description of class 'PLYReader' <p>
+   * \brief Aim: reads binary little-endian PLY files (Stanford polygon
+   * file format) in place, without parsing the records.
+   *
+   * The file is memory-mapped (see MappedFile) and only its
+   * header is parsed at construction. The values of a property are
+   * then decoded directly from the mapping (readProperty, readVectors,
+   * readList, readAttributes). The records of an element without list
+   * property have a fixed size, so that they can also be accessed
+   * without any copy with data(), stride() and offset():
+   * @code
+   * PLYReader ply( "mesh.ply" );
+   * const char * x = ply.data( "vertex" ) + ply.offset( "vertex", "x" );
+   * for ( std::size_t i = 0; i < ply.size( "vertex" ); ++i, x += ply.stride( "vertex" ) )
+   *   ... // x points to the (little-endian) x coordinate of vertex i.
+   * @endcode
+   *
+   * All the PLY scalar types are supported (char, uchar, short, ushort,
+   * int, uint, float, double, and their sized aliases int8, uint8,
+   * ..., float64). ASCII and big-endian files are not supported.
+   *
+   * Used by SurfaceMeshReader::readPLY, MeshReader::importPLYFile and
+   * Shortcuts::makeIdxDigitalSurfaceFromPLY.
+   *
+   * @see PLYWriter
+   */
+  class PLYReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps the file and parses its header.
+     * @param filename the file name.
+     * @throw IOException if the file cannot be read, is not a binary
+     * little-endian PLY file or is truncated.
+     */
+    PLYReader( const std::string & filename );
+
+    /// Copy constructor (deleted).
+    PLYReader( const PLYReader & other ) = delete;
+
+    /// Assignment (deleted).
+    PLYReader & operator= ( const PLYReader & other ) = delete;
+
+    // ----------------------- Header services --------------------------------
+  public:
+
+    /// @return the names of the elements, in the file order.
+    std::vector< std::string > elements() const;
+
+    /// @param element the name of an element.
+    /// @return its number of records (0 if it does not exist).
+    std::size_t size( const std::string & element ) const;
+
+    /// @param element the name of an element.
+    /// @return the names of its properties, in the record order.
+    std::vector< std::string > properties( const std::string & element ) const;
+
+    /// @param element the name of an element.
+    /// @param property the name of a property.
+    /// @return true if the element has this property.
+    bool hasProperty( const std::string & element, const std::string & property ) const;
+
+    /// @return the comments of the header.
+    const std::vector< std::string > & comments() const;
+
+    // ----------------------- Reading services -------------------------------
+  public:
+
+    /**
+     * Reads a scalar property of all the records of an element.
+     * @param element the name of an element.
+     * @param property the name of a (non list) property.
+     * @param[out] values the values, converted to T.
+     * @return true if the property exists and is not a list.
+     * @tparam T any arithmetic type.
+     */
+    template <typename T>
+    bool readProperty( const std::string & element, const std::string & property,
+                       std::vector< T > & values ) const;
+
+    /**
+     * Reads the three properties @a prefix + "x", @a prefix + "y" and
+     * @a prefix + "z" (e.g. the positions for an empty prefix, the
+     * normals for the prefix "n") of all the records of an element.
+     * @param element the name of an element.
+     * @param prefix the prefix of the properties.
+     * @param[out] vectors the vectors.
+     * @return true if the three properties exist.
+     * @tparam TRealVector any model of 3D point or vector.
+     */
+    template <typename TRealVector>
+    bool readVectors( const std::string & element, const std::string & prefix,
+                      std::vector< TRealVector > & vectors ) const;
+
+    /**
+     * Reads a list property of all the records of an element (e.g.
+     * the vertex indices of the faces).
+     * @param element the name of an element.
+     * @param property the name of a list property.
+     * @param[out] lists the lists of values, converted to T.
+     * @return true if the list property exists.
+     * @tparam T any arithmetic type.
+     */
+    template <typename T>
+    bool readList( const std::string & element, const std::string & property,
+                   std::vector< std::vector< T > > & lists ) const;
+
+    /**
+     * Reads all the scalar properties of an element as attributes,
+     * except some of them.
+     * @param element the name of an element.
+     * @param[out] attributes the attributes read (added to the previous ones).
+     * @param excluded the names of the properties to skip (e.g. x, y, z).
+     * @return true if the element exists.
+     */
+    bool readAttributes( const std::string & element, PLYAttributes & attributes,
+                         const std::vector< std::string > & excluded
+                         = std::vector< std::string >() ) const;
+
+    /// @param element the name of an element.
+    /// @return the first byte of its records in the mapped file
+    /// (nullptr if it does not exist).
+    const char * data( const std::string & element ) const;
+
+    /// @param element the name of an element.
+    /// @return the number of bytes of its records, 0 if they have a
+    /// variable size (element with a list property).
+    std::size_t stride( const std::string & element ) const;
+
+    /// @param element the name of an element with fixed-size records.
+    /// @param property the name of a property.
+    /// @return the position of the property in the records, or
+    /// std::size_t( -1 ) if it does not exist or if it follows a list.
+    std::size_t offset( const std::string & element, const std::string & property ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Types ----------------------------------------
+  private:
+    /// The PLY scalar types.
+    enum Type { INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64 };
+
+    /// A property of an element.
+    struct Property
+    {
+      /// The name of the property.
+      std::string name;
+      /// True for a list property.
+      bool list;
+      /// The type of the property (of its items for a list).
+      Type type;
+      /// The type of the number of items of a list.
+      Type countType;
+    };
+
+    /// An element and the layout of its records in the file.
+    struct Element
+    {
+      /// The name of the element.
+      std::string name;
+      /// The number of records.
+      std::size_t count;
+      /// The properties of the records.
+      std::vector< Property > properties;
+      /// The position of the first record in the file.
+      std::size_t begin;
+      /// The size of the records (0 if they have a list property).
+      std::size_t stride;
+      /// The positions of the records in the file, if they have a
+      /// list property.
+      std::vector< std::size_t > records;
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The mapped file.
+    MappedFile myFile;
+    /// The first byte of the file.
+    const char * myData;
+    /// The size of the file.
+    std::size_t mySize;
+    /// The comments of the header.
+    std::vector< std::string > myComments;
+    /// The elements.
+    std::vector< Element > myElements;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Parses the header and computes the layout of the records.
+    void parse( const std::string & filename );
+
+    /// @return the element of name @a name, or nullptr.
+    const Element * findElement( const std::string & name ) const;
+
+    /// @return the index of the property @a name of @a element, or
+    /// std::size_t( -1 ).
+    static std::size_t findProperty( const Element & element, const std::string & name );
+
+    /// @return true and sets @a type if @a name is a PLY type.
+    static bool parseType( const std::string & name, Type & type );
+
+    /// @return the number of bytes of a value of type @a type.
+    static std::size_t typeSize( Type type );
+
+    /// @return the little-endian value of type @a type at @a p, converted to T.
+    template <typename T>
+    static T decode( const char * p, Type type );
+
+    /// @return the position of the property @a k in the record of
+    /// element @a element at position @a record.
+    std::size_t position( const Element & element, std::size_t record,
+                          std::size_t k ) const;
+
+    /// @return the position of record @a i of element @a element.
+    std::size_t record( const Element & element, std::size_t i ) const;
+
+  }; // end of class PLYReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PLYReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PLYReader' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PLYReader & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/PLYReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PLYReader_h
+
+#undef PLYReader_RECURSES
+#endif // else defined(PLYReader_RECURSES)
@@ -44,7 +44,10 @@
 #include <sstream>
 #include <string>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/PLYAttributes.h"
+#include "DGtal/io/readers/MeshTextParser.h"
 #include "DGtal/shapes/SurfaceMesh.h"
 
 namespace DGtal
@@ -56,6 +59,17 @@ namespace DGtal
      Description of template class 'SurfaceMeshReader' <p> \brief Aim:
      An helper class for reading mesh files (Wavefront OBJ at this point) and creating a SurfaceMesh.
 
+     The OBJ text is parsed in memory (see MeshTextParser): files are
+     memory-mapped, and the lines may be parsed in parallel with a
+     ThreadPool, which is useful for meshes of millions of faces.
+
+     @code
+     typedef SurfaceMeshReader< Z3i::RealPoint, Z3i::RealVector > Reader;
+     Reader::SurfaceMesh smesh;
+     ThreadPool pool;
+     bool ok = Reader::readOBJ( "mesh.obj", smesh, &pool );
+     @endcode
+
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
   */
@@ -97,6 +111,59 @@ namespace DGtal
     /// created mesh is ok.
     static
     bool readOBJ( std::istream & input, SurfaceMesh & smesh );
+
+    /// Reads an OBJ file and outputs the corresponding surface mesh.
+    /// The file is memory-mapped and parsed in place.
+    ///
+    /// @param[in] filename the name of the OBJ file.
+    /// @param[out] smesh the output surface mesh.
+    /// @param[in] aThreadPool if not null, the lines of the file are
+    /// parsed in parallel by the threads of this pool.
+    ///
+    /// @return 'true' if both reading the file was ok and the
+    /// created mesh is ok.
+    /// @throw IOException if the file cannot be read.
+    static
+    bool readOBJ( const std::string & filename, SurfaceMesh & smesh,
+                  ThreadPool * aThreadPool = nullptr );
+
+    /// Parses an OBJ text in memory and outputs the corresponding
+    /// surface mesh. The lines are independent, so that ranges of
+    /// lines are parsed in parallel when a ThreadPool is given, then
+    /// merged in order.
+    ///
+    /// @param[in] begin the first character of the text.
+    /// @param[in] end the character after the last character of the text.
+    /// @param[out] smesh the output surface mesh.
+    /// @param[in] aThreadPool if not null, the ranges of lines are
+    /// parsed by the threads of this pool.
+    ///
+    /// @return 'true' if the created mesh is ok.
+    static
+    bool readOBJ( const char * begin, const char * end, SurfaceMesh & smesh,
+                  ThreadPool * aThreadPool = nullptr );
+
+    /// Reads a binary little-endian PLY file (see PLYReader) and
+    /// outputs the corresponding surface mesh. The positions are the
+    /// properties x, y, z of the vertex element, the faces the list
+    /// property vertex_indices (or vertex_index) of the face element,
+    /// and the vertex and face normals the properties nx, ny, nz if
+    /// they exist. The other scalar properties are the attributes.
+    ///
+    /// @param[in] filename the name of the PLY file (e.g. written by
+    /// SurfaceMeshWriter::writePLY).
+    /// @param[out] smesh the output surface mesh.
+    /// @param[out] vertexAttributes if not null, the other vertex properties.
+    /// @param[out] faceAttributes if not null, the other face properties.
+    ///
+    /// @return 'true' if both reading the file was ok and the
+    /// created mesh is ok.
+    /// @throw IOException if the file cannot be read or is not a
+    /// binary little-endian PLY file.
+    static
+    bool readPLY( const std::string & filename, SurfaceMesh & smesh,
+                  PLYAttributes * vertexAttributes = nullptr,
+                  PLYAttributes * faceAttributes = nullptr );
   };
   
 } // namespace DGtal
@@ -0,0 +1,279 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolPayloadReader.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module VolPayloadReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolPayloadReader_RECURSES)
+#error Recursive header files inclusion detected in VolPayloadReader.h
+#else // defined(VolPayloadReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolPayloadReader_RECURSES
+
+#if !defined VolPayloadReader_h
+/** Prevents repeated inclusion of headers. */
+#define VolPayloadReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/MappedFile.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class VolPayloadReader
+  /**
+   * Description of class 'VolPayloadReader' <p>
+   * \brief Aim: reads the voxel data (payload) following the header
+   * of a .vol, .longvol or raw file, block by block, inflating it on
+   * the fly when it is zlib-compressed.
+   *
+   * The payload is accessed through a MappedFile: when the file is
+   * memory-mapped, the blocks of an uncompressed payload point
+   * directly into the mapping without any copy, and a compressed
+   * payload is inflated from the mapping into a single block buffer.
+   *
+   * Chunked payloads (Version 4 files, see VolWriter::exportChunkedVol)
+   * start with a block index, the little-endian 64-bit compressed
+   * sizes of the blocks, followed by independently zlib-compressed
+   * blocks of blockBytes() bytes (the last one may be shorter). Each
+   * block can then be inflated on its own (see decodeBlock), in
+   * parallel or selectively.
+   *
+   * Used by VolReader and LongvolReader to transform the voxel values
+   * block by block into the image buffer, and by VolStreamReader to
+   * read sub-domains (seek).
+   *
+   * @code
+   * VolPayloadReader payload( filename, offset, compressed );
+   * const unsigned char * block;
+   * std::size_t n;
+   * while ( ( n = payload.next( block, 1 << 20 ) ) != 0 )
+   *   ... // process the n bytes of block.
+   * @endcode
+   */
+  class VolPayloadReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Opens the file and prepares the payload reading.
+     * @param filename the file name.
+     * @param offset the position of the payload in the file (i.e. the
+     * size of the header).
+     * @param compressed true if the payload is zlib-compressed.
+     * @param nbBlocks the number of blocks of a chunked payload (0
+     * if the payload is not chunked).
+     * @param blockBytes the number of (inflated) bytes of the blocks
+     * of a chunked payload.
+     * @throw IOException if the file cannot be read.
+     */
+    VolPayloadReader( const std::string & filename, std::size_t offset,
+                      bool compressed, std::size_t nbBlocks = 0,
+                      std::size_t blockBytes = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~VolPayloadReader();
+
+    /// Copy constructor (deleted).
+    VolPayloadReader( const VolPayloadReader & other ) = delete;
+
+    /// Assignment (deleted).
+    VolPayloadReader & operator= ( const VolPayloadReader & other ) = delete;
+
+    // ----------------------- Reading services -------------------------------
+  public:
+
+    /**
+     * Gives the next bytes of the (inflated) payload.
+     *
+     * @param[out] block a pointer on the bytes, valid until the next
+     * call to next, read or skip.
+     * @param maxBytes the maximal number of bytes to give.
+     * @return the number of bytes pointed by @a block, which is
+     * maxBytes unless the end of the payload is reached (or a corrupted
+     * compressed payload) or, for chunked payloads, the end of a
+     * block, 0 at the end.
+     */
+    std::size_t next( const unsigned char * & block, std::size_t maxBytes );
+
+    /**
+     * Copies the next bytes of the (inflated) payload.
+     * @param dst the destination, of size at least @a n.
+     * @param n the number of bytes to read.
+     * @return the number of bytes read (less than @a n at the end).
+     */
+    std::size_t read( unsigned char * dst, std::size_t n );
+
+    /**
+     * Skips the next bytes of the (inflated) payload.
+     * @param n the number of bytes to skip.
+     * @return the number of bytes skipped (less than @a n at the end).
+     */
+    std::size_t skip( std::size_t n );
+
+    /**
+     * Moves to a given position of the (inflated) payload. Raw
+     * payloads are accessed randomly at no cost. Compressed payloads
+     * are inflated forward up to @a aPosition, and from the beginning
+     * when @a aPosition is before the current position.
+     * @param aPosition a position in the (inflated) payload.
+     * @return true if the position has been reached, false if the
+     * payload is shorter.
+     */
+    bool seek( std::size_t aPosition );
+
+    /// @return the number of bytes of the payload in the file
+    /// (compressed size for compressed payloads).
+    std::size_t fileSize() const;
+
+    /// @return the number of (inflated) payload bytes read so far.
+    std::size_t position() const;
+
+    /// @return true if the file is memory-mapped.
+    bool isMapped() const;
+
+    /// @return the number of blocks of a chunked payload (0 if the
+    /// payload is not chunked).
+    std::size_t nbBlocks() const;
+
+    /// @return the number of (inflated) bytes of the blocks of a
+    /// chunked payload.
+    std::size_t blockBytes() const;
+
+    /**
+     * Inflates a block of a chunked payload. This method does not
+     * modify the reader, so that several blocks can be inflated in
+     * parallel.
+     *
+     * @param i the index of the block, less than nbBlocks().
+     * @param dst the destination, of size at least blockBytes().
+     * @return the number of inflated bytes (0 if the block is
+     * missing or corrupted).
+     */
+    std::size_t decodeBlock( std::size_t i, unsigned char * dst ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// (Re)starts the inflation of a compressed payload at its beginning.
+    void resetInflater();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The size of the block buffer used to inflate compressed payloads.
+    static const std::size_t BUFFER_SIZE = 1 << 20;
+
+    /// The file, from the first byte of the payload.
+    MappedFile myFile;
+    /// True if the payload is zlib-compressed.
+    bool myCompressed;
+    /// The number of payload bytes read so far.
+    std::size_t myPosition;
+    /// The number of (inflated) bytes of the blocks of a chunked payload.
+    std::size_t myBlockBytes;
+    /// The positions of the blocks of a chunked payload in the file
+    /// payload, followed by the end of the last block.
+    std::vector<std::size_t> myBlockOffsets;
+    /// The block of a chunked payload inflated in myBuffer.
+    std::size_t myBlock;
+    /// The number of bytes of the block inflated in myBuffer.
+    std::size_t myBlockSize;
+    /// The inflating stream of a compressed payload.
+    std::unique_ptr< boost::iostreams::filtering_streambuf<boost::iostreams::input> > myInflater;
+    /// The buffer receiving the inflated bytes.
+    std::vector<unsigned char> myBuffer;
+
+  }; // end of class VolPayloadReader
+
+  namespace detail
+  {
+    /**
+     * Tells if an image stores its values in a contiguous buffer in
+     * the order of its domain, so that VolReader and LongvolReader can
+     * transform the payload directly into the buffer.
+     * @tparam TImage any image type.
+     */
+    template <typename TImage>
+    struct HasLinearStorage : std::false_type {};
+
+    /// ImageContainerBySTLVector has a linear storage (except for bool
+    /// values, stored in a std::vector<bool>).
+    template <typename TDomain, typename TValue>
+    struct HasLinearStorage< ImageContainerBySTLVector<TDomain, TValue> >
+      : std::integral_constant< bool, ! std::is_same<TValue, bool>::value > {};
+  } // namespace detail
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'VolPayloadReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'VolPayloadReader' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const VolPayloadReader & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/VolPayloadReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolPayloadReader_h
+
+#undef VolPayloadReader_RECURSES
+#endif // else defined(VolPayloadReader_RECURSES)
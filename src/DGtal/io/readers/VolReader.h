@@ -44,8 +44,11 @@
 #include <sstream>
 #include <string>
 #include <cstdio>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/io/readers/VolPayloadReader.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -110,12 +113,54 @@ namespace DGtal
      *
  
      * @return an instance of the ImageContainer.
+     *
+     * The voxel data is read (memory-mapped when possible) and
+     * inflated by blocks with VolPayloadReader. When ImageContainer is
+     * an ImageContainerBySTLVector, the functor is applied block by
+     * block directly into the image buffer, otherwise values are set
+     * point by point.
+     *
+     * Chunked files (Version 4, see VolWriter::exportChunkedVol) are
+     * inflated block by block, in parallel when @a aThreadPool is given
+     * and ImageContainer is an ImageContainerBySTLVector.
+     *
+     * @param aThreadPool if not null, the thread pool used to inflate
+     * the blocks of chunked files.
      */
     static ImageContainer importVol(const std::string & filename, 
-                                    const Functor & aFunctor =  Functor());
+                                    const Functor & aFunctor =  Functor(),
+                                    ThreadPool * aThreadPool = nullptr);
     
   private:
 
+    /**
+     * Reads @a total voxels of the payload into @a image, block by
+     * block into the image buffer.
+     * @param image the image, of @a total points.
+     * @param payload the payload of the file.
+     * @param aFunctor the functor used to cast the values.
+     * @param total the number of voxels.
+     * @param aThreadPool if not null, the thread pool used to inflate
+     * the blocks of a chunked payload.
+     * @return the number of voxels read.
+     */
+    static std::size_t readPayload( ImageContainer & image, VolPayloadReader & payload,
+                                    const Functor & aFunctor, std::size_t total,
+                                    ThreadPool * aThreadPool, std::true_type );
+
+    /**
+     * Reads @a total voxels of the payload into @a image, point by point.
+     * @param image the image, of @a total points.
+     * @param payload the payload of the file.
+     * @param aFunctor the functor used to cast the values.
+     * @param total the number of voxels.
+     * @param aThreadPool unused.
+     * @return the number of voxels read.
+     */
+    static std::size_t readPayload( ImageContainer & image, VolPayloadReader & payload,
+                                    const Functor & aFunctor, std::size_t total,
+                                    ThreadPool * aThreadPool, std::false_type );
+
     typedef unsigned char voxel;
     /**
      * This class help us to associate a field type and his value.
@@ -0,0 +1,292 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolStreamReader.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module VolStreamReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolStreamReader_RECURSES)
+#error Recursive header files inclusion detected in VolStreamReader.h
+#else // defined(VolStreamReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolStreamReader_RECURSES
+
+#if !defined VolStreamReader_h
+/** Prevents repeated inclusion of headers. */
+#define VolStreamReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/readers/VolPayloadReader.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VolStreamReader
+  /**
+   * Description of template class 'VolStreamReader' <p>
+   * \brief Aim: reads sub-domains of the image stored in a .vol,
+   * .longvol or raw file on demand, without loading the whole
+   * volume in memory.
+   *
+   * The header is parsed at construction, then @ref readSubDomain
+   * and @ref readSlab import any sub-domain of the file domain (e.g.
+   * slabs along the last axis), possibly larger than the available
+   * memory. The payload is accessed with a VolPayloadReader:
+   *
+   * - uncompressed payloads (.vol/.longvol version 2 files, raw files)
+   *   are memory-mapped, and only the rows of the sub-domain are read;
+   * - compressed payloads (version 3 files) are inflated sequentially,
+   *   and inflation restarts from the beginning of the payload when a
+   *   sub-domain starts before the previous one. Sub-domains should
+   *   then be requested in the file order (e.g. slabs of increasing
+   *   last coordinate);
+   * - chunked payloads (version 4 files) are made of independently
+   *   compressed blocks, and only the blocks intersecting the rows of
+   *   the sub-domain are inflated, in any order.
+   *
+   * The voxel values are words of type @a TWord stored in
+   * little-endian order in the domain order: unsigned char in .vol
+   * files, 64-bit unsigned integers in .longvol files, any type in
+   * raw files (as RawReader::importRaw).
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * VolStreamReader<Image> reader( "data.vol" );
+   * const Z3i::Integer zmin = reader.domain().lowerBound()[ 2 ];
+   * const Z3i::Integer zmax = reader.domain().upperBound()[ 2 ];
+   * for ( Z3i::Integer z = zmin; z <= zmax; z += 16 )
+   *   {
+   *     Image slab = reader.readSlab( z, z + 15 );
+   *     ... // process the slab.
+   *   }
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use (model of CImage).
+   * @tparam TWord the type of the voxel values stored in the file
+   * (unsigned char for .vol files, DGtal::uint64_t for .longvol files).
+   * @tparam TFunctor the type of functor used to cast the words into
+   * image values (by default set to functors::Cast< TImageContainer::Value>).
+   *
+   * @see ImageFactoryFromVol, VolReader, LongvolReader, RawReader
+   * @see testVolStreamReader.cpp
+   */
+  template <typename TImageContainer,
+            typename TWord = unsigned char,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  class VolStreamReader
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef VolStreamReader<TImageContainer, TWord, TFunctor> Self;
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Value Value;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef TWord Word;
+    typedef TFunctor Functor;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<TFunctor, Word, Value > ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from a .vol or a .longvol file, parses the header.
+     *
+     * @param filename the file name.
+     * @param aFunctor the functor used to cast the words into image values.
+     * @throw IOException if the header is invalid, or if the file
+     * stores voxels of another size than Word (1 byte in .vol files, 8
+     * bytes in .longvol files).
+     */
+    VolStreamReader( const std::string & filename,
+                     const Functor & aFunctor = Functor() );
+
+    /**
+     * Constructor from a raw file.
+     *
+     * @param filename the file name.
+     * @param extent the size of the raw data set (the domain is
+     * [0,extent-1]).
+     * @param offset the position of the voxel data in the file.
+     * @param aFunctor the functor used to cast the words into image values.
+     * @throw IOException if the file cannot be read.
+     */
+    VolStreamReader( const std::string & filename, const Vector & extent,
+                     std::size_t offset = 0,
+                     const Functor & aFunctor = Functor() );
+
+    /// Copy constructor (deleted).
+    VolStreamReader( const VolStreamReader & other ) = delete;
+
+    /// Assignment (deleted).
+    VolStreamReader & operator= ( const VolStreamReader & other ) = delete;
+
+    // ----------------------- Reading services -------------------------------
+  public:
+
+    /// @return the domain of the image stored in the file.
+    const Domain & domain() const;
+
+    /// @return true if the payload is zlib-compressed (chunked or not).
+    bool isCompressed() const;
+
+    /**
+     * Reads the values of a sub-domain.
+     *
+     * @param aDomain a sub-domain of domain().
+     * @return an image of domain @a aDomain.
+     * @throw IOException if the file is truncated.
+     */
+    ImageContainer readSubDomain( const Domain & aDomain );
+
+    /**
+     * Reads the values of a sub-domain into an output iterator, in
+     * the order of @a aDomain.
+     *
+     * @param aDomain a sub-domain of domain().
+     * @param out any output iterator on values.
+     * @return the output iterator after the last value.
+     * @throw IOException if the file is truncated.
+     *
+     * @tparam TOutputIterator a model of boost::OutputIterator on Value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator readSubDomain( const Domain & aDomain, TOutputIterator out );
+
+    /**
+     * @param first the first coordinate of the slab along the last axis.
+     * @param last the last coordinate of the slab along the last axis.
+     * @return the slab of domain() between @a first and @a last
+     * (clamped to domain()) along its last axis.
+     */
+    Domain slabDomain( Integer first, Integer last ) const;
+
+    /**
+     * Reads a slab along the last axis (a Z-slab in 3D).
+     *
+     * @param first the first coordinate of the slab along the last axis.
+     * @param last the last coordinate of the slab along the last axis.
+     * @return an image of domain slabDomain( first, last ).
+     * @throw IOException if the file is truncated.
+     */
+    ImageContainer readSlab( Integer first, Integer last );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The number of bytes decoded at once.
+    static const std::size_t BLOCK_SIZE = 1 << 20;
+
+    /// The file name.
+    std::string myFilename;
+    /// The domain of the image stored in the file.
+    Domain myDomain;
+    /// The extent of myDomain.
+    Vector myExtent;
+    /// The payload of the file.
+    std::unique_ptr<VolPayloadReader> myPayload;
+    /// True if the payload is zlib-compressed.
+    bool myCompressed;
+    /// The functor used to cast the words into image values.
+    Functor myFunctor;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Reads @a nb consecutive words from @a position (in words) of
+     * the payload into @a out, which is advanced past them. It is
+     * passed by reference since output iterators such as
+     * SetValueIterator are not meant to be assigned.
+     */
+    template <typename TOutputIterator>
+    void readRun( std::size_t position, std::size_t nb,
+                  TOutputIterator & out );
+
+    /**
+     * Reads the image of a sub-domain, directly into the image buffer.
+     */
+    ImageContainer readImage( const Domain & aDomain, std::true_type );
+
+    /**
+     * Reads the image of a sub-domain, point by point.
+     */
+    ImageContainer readImage( const Domain & aDomain, std::false_type );
+
+  }; // end of class VolStreamReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'VolStreamReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'VolStreamReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TWord, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const VolStreamReader<TImageContainer, TWord, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/VolStreamReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolStreamReader_h
+
+#undef VolStreamReader_RECURSES
+#endif // else defined(VolStreamReader_RECURSES)
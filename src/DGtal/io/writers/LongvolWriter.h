@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/base/ThreadPool.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -91,9 +92,39 @@ namespace DGtal
     static bool exportLongvol(const std::string & filename, const Image &aImage,
                               const bool compressed = true,
                               const Functor & aFunctor = Functor());
+
+    /**
+     * Export an Image with the chunked Longvol format (Version 4):
+     * the voxel data is cut into blocks of @a aBlockSize voxels which
+     * are compressed independently, and preceded by a block index
+     * (see VolPayloadWriter). A DGtal::IOException is thrown in case
+     * of io problems.
+     *
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aFunctor functor used to cast image values
+     * @param aBlockSize the number of voxels of a block, between 1
+     * and INT_MAX (a DGtal::IOException is thrown otherwise).
+     * @param aThreadPool if not null, the thread pool used to
+     * compress the blocks.
+     * @return true if no errors occur.
+     */
+    static bool exportChunkedLongvol(const std::string & filename, const Image &aImage,
+                                     const Functor & aFunctor = Functor(),
+                                     std::size_t aBlockSize = 1 << 17,
+                                     ThreadPool * aThreadPool = nullptr);
     
     
   private: 
+
+    /**
+     * Writes the header fields describing the domain and the voxels
+     * (all but the Version and the ending ".").
+     *
+     * @param out the output stream.
+     * @param domain the image domain.
+     */
+    static void writeHeader(std::ostream & out, const typename Image::Domain & domain);
     
     /** 
      * Generic write word (binary mode) in little-endian.
@@ -119,6 +119,21 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh);
+
+    /**
+     * Export a Mesh towards a binary little-endian PLY format (see
+     * PLYWriter). The vertices have the double properties x, y, z and
+     * the faces the list property vertex_indices, followed by the
+     * uchar properties red, green, blue, alpha if the face colors are
+     * exported.
+     *
+     * @param out the output stream, opened in binary mode.
+     * @param aMesh the Mesh object to be exported.
+     * @param exportColor true to export the face colors if they are stored in the Mesh object (default true).
+     * @return true if no errors occur.
+     */
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh,
+                           bool exportColor=true);
     
     
   };
@@ -130,7 +145,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PLYWriter.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PLYWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PLYWriter_RECURSES)
+#error Recursive header files inclusion detected in PLYWriter.h
+#else // defined(PLYWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PLYWriter_RECURSES
+
+#if !defined PLYWriter_h
+/** Prevents repeated inclusion of headers. */
+#define PLYWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/PLYAttributes.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class PLYWriter
+  /**
+   * Description of class 'PLYWriter' <p>
+   * \brief Aim: writes binary little-endian PLY files (Stanford
+   * polygon file format), element by element.
+   *
+   * A PLY file is an ASCII header describing the elements (e.g.
+   * vertex, face) and the properties of their records, followed by
+   * the records of each element in binary form. Fixed-size records
+   * (without list property) are stored contiguously, so that they can
+   * be accessed without any parsing or copy once the file is
+   * memory-mapped (see PLYReader).
+   *
+   * The header is declared with addElement, addProperty,
+   * addListProperty (which apply to the last declared element), then
+   * written by writeHeader. The records are then appended value by
+   * value with put, whose argument types must match the declared
+   * property types:
+   *
+   * | PLY type | C++ type |
+   * |----------|----------|
+   * | char     | DGtal::int8_t   |
+   * | uchar    | DGtal::uint8_t  |
+   * | short    | DGtal::int16_t  |
+   * | ushort   | DGtal::uint16_t |
+   * | int      | DGtal::int32_t  |
+   * | uint     | DGtal::uint32_t |
+   * | float    | float           |
+   * | double   | double          |
+   *
+   * Used by SurfaceMeshWriter::writePLY, MeshWriter::export2PLY and
+   * Shortcuts::savePLY.
+   *
+   * @code
+   * std::ofstream out( "triangle.ply", std::ios::binary );
+   * PLYWriter ply( out );
+   * ply.addElement( "vertex", 3 );
+   * ply.addProperty( "x", "double" ); ...
+   * ply.addElement( "face", 1 );
+   * ply.addListProperty( "vertex_indices", "uchar", "uint" );
+   * ply.writeHeader();
+   * ply.put( 0.0 ); ...
+   * ply.put( DGtal::uint8_t( 3 ) ); ply.put( DGtal::uint32_t( 0 ) ); ...
+   * ply.flush();
+   * @endcode
+   *
+   * @see PLYReader
+   */
+  class PLYWriter
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param out the output stream, opened in binary mode.
+     */
+    PLYWriter( std::ostream & out );
+
+    /**
+     * Destructor, flushes the pending records.
+     */
+    ~PLYWriter();
+
+    /// Copy constructor (deleted).
+    PLYWriter( const PLYWriter & other ) = delete;
+
+    /// Assignment (deleted).
+    PLYWriter & operator= ( const PLYWriter & other ) = delete;
+
+    // ----------------------- Header services --------------------------------
+  public:
+
+    /// Adds a comment line to the header.
+    /// @param comment the comment (without line feed).
+    void addComment( const std::string & comment );
+
+    /// Declares a new element.
+    /// @param name the name of the element (e.g. vertex or face).
+    /// @param count the number of records of the element.
+    void addElement( const std::string & name, std::size_t count );
+
+    /// Declares a property of the last declared element.
+    /// @param name the name of the property.
+    /// @param type the PLY type of the property (e.g. double).
+    void addProperty( const std::string & name, const std::string & type );
+
+    /// Declares a list property of the last declared element.
+    /// @param name the name of the property.
+    /// @param countType the PLY type of the number of items (e.g. uchar).
+    /// @param itemType the PLY type of the items (e.g. uint).
+    void addListProperty( const std::string & name, const std::string & countType,
+                          const std::string & itemType );
+
+    /// Declares a double property of the last declared element for
+    /// each attribute of @a attributes (in the order of their names).
+    /// @param attributes some attributes.
+    void addAttributes( const PLYAttributes & attributes );
+
+    /// Writes the header.
+    void writeHeader();
+
+    // ----------------------- Record services --------------------------------
+  public:
+
+    /**
+     * Appends a value to the records, in little-endian order.
+     * @param value the value, whose type is the one of the property.
+     * @tparam T the C++ type matching the PLY type of the property.
+     */
+    template <typename T>
+    void put( T value );
+
+    /**
+     * Appends the values of the attributes of a record, in the order
+     * of addAttributes.
+     * @param attributes some attributes.
+     * @param i the index of the record.
+     */
+    void putAttributes( const PLYAttributes & attributes, std::size_t i );
+
+    /**
+     * Writes the pending records to the output stream.
+     * @return true if the output stream is good.
+     */
+    bool flush();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The number of pending bytes written at once.
+    static const std::size_t BUFFER_SIZE = 1 << 20;
+
+    /// The output stream.
+    std::ostream & myOut;
+    /// The header.
+    std::string myHeader;
+    /// The pending records.
+    std::vector< char > myBuffer;
+    /// True if the header has been written.
+    bool myHeaderWritten;
+
+  }; // end of class PLYWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PLYWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PLYWriter' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PLYWriter & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/PLYWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PLYWriter_h
+
+#undef PLYWriter_RECURSES
+#endif // else defined(PLYWriter_RECURSES)
@@ -47,6 +47,7 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/SurfaceMesh.h"
 #include "DGtal/io/Color.h"
+#include "DGtal/io/PLYAttributes.h"
 
 namespace DGtal
 {
@@ -55,7 +56,7 @@ namespace DGtal
   // template class SurfaceMeshWriter
   /**
      Description of template class 'SurfaceMeshWriter' <p> \brief Aim:
-     An helper class for writing mesh file formats (Waverfront OBJ at this point) and creating a SurfaceMesh.
+     An helper class for writing mesh file formats (Waverfront OBJ and binary PLY at this point) and creating a SurfaceMesh.
 
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
@@ -87,6 +88,25 @@ namespace DGtal
     static
     bool writeOBJ( std::ostream & output, const SurfaceMesh & smesh );
 
+    /// Writes a surface mesh in an output stream, in binary
+    /// little-endian PLY file format (see PLYWriter). The vertex
+    /// element has the double properties x, y, z, then nx, ny, nz if
+    /// the vertex normals are set, then the vertex attributes. The face
+    /// element has the list property vertex_indices, then nx, ny, nz if
+    /// the face normals are set, then the face attributes.
+    ///
+    /// @param[in,out] output the output stream, opened in binary mode.
+    /// @param[in] smesh the surface mesh.
+    /// @param[in] vertexAttributes some scalar values per vertex (e.g. curvatures).
+    /// @param[in] faceAttributes some scalar values per face.
+    /// @return 'true' if writing in the output stream was ok, 'false'
+    /// if it failed or if some attribute has not one value per vertex
+    /// (resp. face).
+    static
+    bool writePLY( std::ostream & output, const SurfaceMesh & smesh,
+                   const PLYAttributes & vertexAttributes = PLYAttributes(),
+                   const PLYAttributes & faceAttributes = PLYAttributes() );
+
     /// Writes a surface mesh in the given OBJ file (and an associated
     /// MTL file) and associate color information.
     ///
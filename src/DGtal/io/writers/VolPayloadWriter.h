@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolPayloadWriter.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module VolPayloadWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolPayloadWriter_RECURSES)
+#error Recursive header files inclusion detected in VolPayloadWriter.h
+#else // defined(VolPayloadWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolPayloadWriter_RECURSES
+
+#if !defined VolPayloadWriter_h
+/** Prevents repeated inclusion of headers. */
+#define VolPayloadWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct VolPayloadWriter
+  /**
+   * Description of struct 'VolPayloadWriter' <p>
+   * \brief Aim: writes the voxel data (payload) of a chunked .vol or
+   * .longvol file (Version 4), i.e. independently zlib-compressed
+   * blocks preceded by a block index.
+   *
+   * The payload is cut into blocks of @a blockBytes bytes (the last
+   * one may be shorter), compressed in parallel when a ThreadPool is
+   * given. The block index, i.e. the compressed sizes of the blocks as
+   * little-endian 64-bit integers, is written first, followed by the
+   * compressed blocks. Since the blocks are independent, a reader can
+   * inflate them in parallel or selectively (see VolPayloadReader).
+   *
+   * Used by VolWriter::exportChunkedVol and
+   * LongvolWriter::exportChunkedLongvol.
+   */
+  struct VolPayloadWriter
+  {
+    /**
+     * @param size the number of bytes of the payload.
+     * @param blockBytes the number of bytes of a block.
+     * @return the number of blocks of the payload.
+     */
+    static std::size_t nbBlocks( std::size_t size, std::size_t blockBytes );
+
+    /**
+     * Compresses the payload by blocks and writes the block index
+     * and the blocks.
+     *
+     * @param out the output stream.
+     * @param data the payload.
+     * @param size the number of bytes of the payload.
+     * @param blockBytes the number of bytes of a block (positive).
+     * @param aThreadPool if not null, the thread pool used to
+     * compress the blocks.
+     * @throw IOException if the compression fails.
+     */
+    static void writeChunked( std::ostream & out, const unsigned char * data,
+                              std::size_t size, std::size_t blockBytes,
+                              ThreadPool * aThreadPool = nullptr );
+  }; // end of struct VolPayloadWriter
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/VolPayloadWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolPayloadWriter_h
+
+#undef VolPayloadWriter_RECURSES
+#endif // else defined(VolPayloadWriter_RECURSES)
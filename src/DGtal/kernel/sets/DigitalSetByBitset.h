@@ -0,0 +1,474 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitset.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSetByBitset.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitset_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitset.h
+#else // defined(DigitalSetByBitset_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitset_RECURSES
+
+#if !defined DigitalSetByBitset_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitset_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitset
+  /**
+    Description of template class 'DigitalSetByBitset' <p>
+
+    \brief Aim: A container class for storing sets of digital points
+    within a HyperRectDomain, with one bit per point of the domain.
+
+    The points of the domain are linearized (column-major order, see
+    Linearizer) and the set is stored as an array of 64-bit words. The
+    memory footprint is thus the size of the domain divided by 8
+    bytes, whatever the number of points in the set, which is much
+    smaller than the 32+ bytes per point of DigitalSetBySTLSet or
+    DigitalSetByAssociativeContainer as soon as the set fills a
+    noticeable part of its domain. This is the container chosen by
+    DigitalSetSelector for \c WHOLE_DS sets.
+
+    Insertion, removal and membership tests are O(1). Iteration scans
+    the words and jumps to the set bits, visiting points in the order
+    of the domain. Union (operator+=), intersection (operator*=),
+    difference (operator-=) and complement of sets sharing the same
+    domain are computed word by word, and the size of the result is
+    counted with popcounts of the words.
+
+    Model of CDigitalSet.
+
+    @code
+    Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 255, 255, 255 ) );
+    DigitalSetByBitset< Z3i::Domain > A( domain ), B( domain );
+    ...
+    A *= B; // A is the intersection of A and B.
+    @endcode
+
+    @tparam TDomain the domain type, a HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByBitset
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitset<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    /// The type of the words storing the bits.
+    typedef DGtal::uint64_t Word;
+    /// The underlying container, one bit per point of the domain.
+    typedef std::vector<Word> Container;
+    /// Linearization of the points of the domain.
+    typedef Linearizer<Domain, ColMajorStorage> Linearization;
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+
+    /// Number of bits of a word.
+    static const unsigned int BITS_PER_WORD = 64;
+
+    /**
+       Read iterator on the points of the set, visited in the order
+       of the domain. Model of ForwardIterator.
+
+       Since the set has no storage for points, the iterator
+       dereferences to a point value.
+    */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::forward_traversal_tag,
+                                       Point const >
+    {
+      friend class DigitalSetByBitset<TDomain>;
+    public:
+      /// Default constructor.
+      ConstIterator() : mySet( nullptr ), myWord( 0 ), myBit( 0 ),
+                        myCurrent( static_cast<Word>(0) ) {}
+
+      /**
+         Constructor from a set and a position.
+         @param aSet the visited set.
+         @param anIndex the linear index of a point of the set, or the
+         number of words times BITS_PER_WORD for the end iterator.
+      */
+      ConstIterator( const Self & aSet, Size anIndex );
+
+      /// @return the linear index of the pointed point.
+      Size index() const
+      { return myWord * BITS_PER_WORD + myBit; }
+
+    private:
+      friend class boost::iterator_core_access;
+      /// Moves to the next set bit.
+      void increment();
+      /// @return true iff both iterators point to the same position.
+      bool equal( const ConstIterator & other ) const
+      { return myWord == other.myWord && myBit == other.myBit; }
+      /// @return the pointed point.
+      const Point dereference() const;
+
+      /// Sets myCurrent and myBit to the first set bit from word
+      /// myWord, skipping empty words.
+      void findNext();
+
+      /// The visited set.
+      const Self* mySet;
+      /// The current word.
+      Size myWord;
+      /// The current bit in the word.
+      unsigned int myBit;
+      /// The current word, where visited bits have been erased.
+      Word myCurrent;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitset() = default;
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitset( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitset ( const DigitalSetByBitset & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator= ( const DigitalSetByBitset & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * Note: faster than giving just the point.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Give access to the underlying container (the words storing the
+     * bits, in the linearization order of the domain).
+     * @return a const reference to the stored container.
+     */
+    const Container & container() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator*=( const Self & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator-=( const Self & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The lower bound of the domain.
+    Point myLowerBound;
+
+    /// The extent of the domain.
+    Point myExtent;
+
+    /// The number of points of the domain.
+    Size myDomainSize;
+
+    /// The words storing one bit per point of the domain.
+    Container myWords;
+
+    /// The number of points in the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitset();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param p any point of the domain.
+    /// @return its linear index.
+    Size index( const Point & p ) const;
+
+    /// @param aSet any other set.
+    /// @return 'true' iff \a aSet has the same domain bounds as this.
+    bool sameDomain( const Self & aSet ) const;
+
+    /// @return the number of set bits, counted word by word.
+    Size countBits() const;
+
+    /// @return the mask of the valid bits of the last word.
+    Word lastWordMask() const;
+
+  }; // end of class DigitalSetByBitset
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitset'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitset' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByBitset<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitset.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitset_h
+
+#undef DigitalSetByBitset_RECURSES
+#endif // else defined(DigitalSetByBitset_RECURSES)
@@ -48,9 +48,11 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
+#include <type_traits>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -83,6 +85,10 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Sets expected to fill a large part of a HyperRectDomain
+   * (WHOLE_DS) are stored with one bit per point of the domain
+   * (DigitalSetByBitset), other sets in hash sets.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -91,7 +97,12 @@ namespace DGtal
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    typedef typename std::conditional<
+      ( Preferences & WHOLE_DS ) == WHOLE_DS
+      && std::is_same< Domain, HyperRectDomain< typename Domain::Space > >::value,
+      DigitalSetByBitset<Domain>,
+      DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> >
+      >::type Type;
   }; // end of class DigitalSetSelector
 
 
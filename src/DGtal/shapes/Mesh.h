@@ -217,6 +217,16 @@ namespace DGtal
     void addVertex(const TPoint &vertex);
 
 
+    /**
+     * Reserves the storage of vertices and faces (and face colors if
+     * they are saved), to add many of them without reallocation.
+     *
+     * @param nbVertices the total number of vertices to store.
+     * @param nbFaces the total number of faces to store.
+     **/
+    void reserve(std::size_t nbVertices, std::size_t nbFaces);
+
+
 
     /**
      * Add a triangle face given from index position.
@@ -0,0 +1,171 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BorderQueueThinning.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BorderQueueThinning.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BorderQueueThinning_RECURSES)
+#error Recursive header files inclusion detected in BorderQueueThinning.h
+#else // defined(BorderQueueThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BorderQueueThinning_RECURSES
+
+#if !defined BorderQueueThinning_h
+/** Prevents repeated inclusion of headers. */
+#define BorderQueueThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Types of the functions given to functions::borderQueueThinning
+     * (outside of the deduced context, so that lambdas can be given).
+     * @tparam TObject any Object type.
+     */
+    template < typename TObject >
+    struct BorderQueueThinningFunctions
+    {
+      /// Tells if a simple point must be kept in the skeleton.
+      typedef std::function<
+        bool( const TObject &, const typename TObject::Point & ) > Skel;
+      /// Priority of a point in its layer, lower values first.
+      typedef std::function< double( const typename TObject::Point & ) > Priority;
+    };
+  } // namespace detail
+
+  namespace functions
+  {
+    /**
+     * Sequential homotopic thinning of a digital object driven by a
+     * queue of border points.
+     *
+     * Instead of scanning the whole object at each pass, only the
+     * points having a neighbor outside the object (in the 3^d - 1
+     * neighborhood) are queued at start. Each time a simple point is
+     * removed, its neighbors in the object are queued, since they are
+     * the only points whose simplicity may change. The cost is thus
+     * proportional to the number of removed points (times the size of
+     * the neighborhood) instead of the number of passes times the
+     * size of the object.
+     *
+     * Points are processed by layer (the initial border is layer 0,
+     * points queued by the removal of a point of layer l are of layer
+     * l+1), so that the object is peeled from its border as with
+     * pass-based thinnings, and within a layer by increasing @a
+     * priority, then by increasing coordinates. Simplicity is read in
+     * the look-up table @a table with Object::isSimpleFromTable,
+     * without computing geodesic neighborhoods.
+     *
+     * @code
+     * auto table = functions::loadTable( simplicity::tableSimple26_6 );
+     * std::vector< Z3i::Point > removed;
+     * functions::borderQueueThinning( object, *table, std::back_inserter( removed ) );
+     * @endcode
+     *
+     * @tparam TObject any Object type.
+     * @tparam TOutputIterator an output iterator on points.
+     *
+     * @param[in,out] obj the object to thin, its point set is modified.
+     * @param[in] table the simplicity table of the topology of @a obj
+     * (e.g. simplicity::tableSimple26_6 for Z3i::Object26_6).
+     * @param[out] removed receives the removed points, in their removal order.
+     * @param[in] Skel if given, simple points for which Skel returns
+     * true when they are examined are kept in the skeleton (e.g. end points).
+     * @param[in] priority if given, the priority of points in their
+     * layer, lower values being removed first (e.g. a distance map).
+     *
+     * @return the number of removed points.
+     */
+    template < typename TObject, typename TOutputIterator >
+    typename TObject::Size
+    borderQueueThinning(
+      TObject & obj,
+      const boost::dynamic_bitset<> & table,
+      TOutputIterator removed,
+      const typename detail::BorderQueueThinningFunctions< TObject >::Skel & Skel = nullptr,
+      const typename detail::BorderQueueThinningFunctions< TObject >::Priority & priority = nullptr );
+
+  } // namespace functions
+
+  namespace detail
+  {
+    /**
+     * Border queue thinning engine shared by functions::borderQueueThinning
+     * and functions::borderQueueThinningScheme.
+     *
+     * @tparam TPoint the type of points.
+     * @param border the initial border points.
+     * @param contains tells if a point is in the current object.
+     * @param isSimple tells if a point of the object is simple.
+     * @param isSkel tells if a simple point must be kept (may be empty).
+     * @param erase removes a point from the object.
+     * @param priority the priority of a point in its layer (may be empty).
+     * @return the number of removed points.
+     */
+    template < typename TPoint >
+    std::size_t
+    borderQueueThinning(
+      const std::vector< TPoint > & border,
+      const std::function< bool( const TPoint & ) > & contains,
+      const std::function< bool( const TPoint & ) > & isSimple,
+      const std::function< bool( const TPoint & ) > & isSkel,
+      const std::function< void( const TPoint & ) > & erase,
+      const std::function< double( const TPoint & ) > & priority );
+
+    /**
+     * @tparam TPoint the type of points.
+     * @return the offsets of the 3^d - 1 neighbors of the origin.
+     */
+    template < typename TPoint >
+    std::vector< TPoint > neighborhoodOffsets();
+
+  } // namespace detail
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/BorderQueueThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BorderQueueThinning_h
+
+#undef BorderQueueThinning_RECURSES
+#endif // else defined(BorderQueueThinning_RECURSES)
@@ -45,6 +45,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CConstSinglePassRange.h"
+#include "DGtal/base/ContainerTraits.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CUnsignedNumber.h"
 #include "DGtal/kernel/CIntegralNumber.h"
@@ -311,18 +312,20 @@ public:
   BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Vector, typename Space::Vector >::value ));
   BOOST_CONCEPT_ASSERT(( CConstSinglePassRange< Cells > ));
   BOOST_CONCEPT_ASSERT(( CConstSinglePassRange< SCells > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< CellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SCellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SurfelSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< CellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< SCellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< SurfelSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< CellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SCellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SurfelMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< CellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< SCellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< SurfelMap > ));
+  // Checked with ContainerTraits so that both ordered and unordered
+  // (hashed) associative containers are accepted.
+  BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< CellSet >::value ));
+  BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< SCellSet >::value ));
+  BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< SurfelSet >::value ));
+  BOOST_STATIC_ASSERT(( IsSimpleAssociativeContainer< CellSet >::value ));
+  BOOST_STATIC_ASSERT(( IsSimpleAssociativeContainer< SCellSet >::value ));
+  BOOST_STATIC_ASSERT(( IsSimpleAssociativeContainer< SurfelSet >::value ));
+  BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< CellMap >::value ));
+  BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< SCellMap >::value ));
+  BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< SurfelMap >::value ));
+  BOOST_STATIC_ASSERT(( IsPairAssociativeContainer< CellMap >::value ));
+  BOOST_STATIC_ASSERT(( IsPairAssociativeContainer< SCellMap >::value ));
+  BOOST_STATIC_ASSERT(( IsPairAssociativeContainer< SurfelMap >::value ));
 
   BOOST_CONCEPT_USAGE( CPreCellularGridSpaceND )
   {
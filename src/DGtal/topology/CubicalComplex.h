@@ -79,6 +79,22 @@ namespace DGtal
     uint32_t data;
   };
 
+  namespace detail {
+    /**
+     * Customization point called by the constructor
+     * CubicalComplex( ConstAlias<KSpace> ) on the container of the
+     * cells of each dimension, for containers that need the space to
+     * allocate their storage (e.g. DenseCellMap). Does nothing by
+     * default.
+     * @tparam TCellContainer the type of cell container.
+     */
+    template < typename TCellContainer >
+    struct CubicalCellContainerInitializer {
+      template < typename TKSpace >
+      static void init( TCellContainer &, const TKSpace &, Dimension ) {}
+    };
+  } // namespace detail
+
   // Forward definitions.
   template < typename TKSpace, typename TCellContainer >
   class CubicalComplex;
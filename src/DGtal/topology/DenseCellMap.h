@@ -0,0 +1,432 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DenseCellMap.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <type_traits>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+   * Description of template class 'DenseCellMap' <p>
+   * \brief Aim: An associative container Cell -> Data, for the cells
+   * of a given dimension of a bounded Khalimsky space, stored in flat
+   * arrays over the whole space.
+   *
+   * It is meant to be the cell container of a CubicalComplex (or a
+   * VoxelComplex) whose cells occupy a large part of a bounded
+   * space. Instead of one tree or hash table node per cell, each
+   * possible cell of the space has a slot in an array of Data, and
+   * one bit tells whether the cell belongs to the map. Queries,
+   * insertions and deletions are thus direct array accesses, and
+   * iteration scans the set bits.
+   *
+   * Cells are indexed by topology: the cells of the map having the
+   * same open directions form a regular grid of the space, stored
+   * contiguously. Only the grids of the dimension given at
+   * initialization are allocated, so that the dimension+1 maps of a
+   * complex cover the Khalimsky space once.
+   *
+   * @code
+   * typedef DenseCellMap< KSpace, CubicalCellData >  Map;
+   * typedef CubicalComplex< KSpace, Map >            CC;
+   * CC complex( K ); // the maps of the complex are initialized from K.
+   * @endcode
+   *
+   * The map is a model of boost::ForwardContainer and
+   * concepts::CSTLAssociativeContainer. As a proxy container, its
+   * iterators return pairs of a cell and a reference to its data
+   * (fields \a first and \a second) instead of references to
+   * std::pair. Iterators are not invalidated by insertions or
+   * deletions of other cells. Cells are visited by topology, then in
+   * the order of their Khalimsky coordinates (last coordinate first).
+   *
+   * @warning A default constructed map has no storage: it must be
+   * initialized with init() before any insertion. Cells outside the
+   * bounds of the space cannot be inserted.
+   *
+   * @tparam TKSpace the type of cellular grid space, a model of
+   * concepts::CCellularGridSpaceND, e.g. KhalimskySpaceND.
+   * @tparam TData the type of data associated to each cell.
+   */
+  template < typename TKSpace, typename TData = CubicalCellData >
+  class DenseCellMap
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef DenseCellMap<TKSpace, TData> Self;
+    typedef TKSpace                      KSpace;
+    typedef TData                        Data;
+    typedef typename KSpace::Integer     Integer;
+    typedef typename KSpace::Point       Point;
+    typedef typename KSpace::Cell        Cell;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    typedef Cell                          key_type;
+    typedef Data                          mapped_type;
+    typedef std::pair< const Cell, Data > value_type;
+    typedef std::size_t                   size_type;
+    typedef std::ptrdiff_t                difference_type;
+    typedef value_type*                   pointer;
+    typedef const value_type*             const_pointer;
+
+    /**
+     * The values visited by the iterators: a cell \a first and a
+     * reference to its data \a second.
+     * @tparam TMapped either Data or const Data.
+     */
+    template <typename TMapped>
+    struct ProxyPair
+    {
+      /// Constructor from a cell and its data.
+      ProxyPair( const Cell & c, TMapped & d ) : first( c ), second( d ) {}
+      /// Conversion from a mutable pair to a constant one.
+      template <typename TOtherMapped>
+      ProxyPair( const ProxyPair<TOtherMapped> & other )
+        : first( other.first ), second( other.second ) {}
+      /// Conversion to a value of the map.
+      operator value_type() const { return value_type( first, second ); }
+      /// The cell.
+      const Cell & first;
+      /// The data associated to the cell.
+      TMapped & second;
+    };
+
+    typedef ProxyPair<Data>       reference;
+    typedef ProxyPair<const Data> const_reference;
+
+    /**
+     * Forward iterator on the cells of the map. The cell of the
+     * dereferenced pair is stored in the iterator, the reference
+     * being valid as long as the iterator is not modified or
+     * destroyed.
+     * @tparam TMap either Self or const Self.
+     * @tparam TReference either reference or const_reference.
+     */
+    template <typename TMap, typename TReference>
+    class IteratorImpl
+      : public boost::iterator_facade< IteratorImpl<TMap, TReference>,
+                                       value_type,
+                                       std::forward_iterator_tag,
+                                       TReference >
+    {
+    public:
+      /// Default (invalid) constructor.
+      IteratorImpl() : myMap( 0 ), myIndex( 0 ) {}
+      /// Constructor from a map and the index of a cell (or the end index).
+      IteratorImpl( TMap* map, size_type index ) : myMap( map ), myIndex( index )
+      {
+        updateCell();
+      }
+      /// Conversion from a mutable iterator to a constant one.
+      template <typename TOtherMap, typename TOtherReference>
+      IteratorImpl( const IteratorImpl<TOtherMap, TOtherReference> & other,
+                    typename std::enable_if< std::is_convertible< TOtherMap*, TMap* >::value >::type* = 0 )
+        : myMap( other.myMap ), myIndex( other.myIndex ), myCell( other.myCell ) {}
+
+    private:
+      friend class boost::iterator_core_access;
+      template <typename, typename> friend class IteratorImpl;
+      friend class DenseCellMap;
+
+      TReference dereference() const
+      {
+        return TReference( myCell, myMap->myData[ myIndex ] );
+      }
+      template <typename TOtherMap, typename TOtherReference>
+      bool equal( const IteratorImpl<TOtherMap, TOtherReference> & other ) const
+      {
+        return myMap == other.myMap && myIndex == other.myIndex;
+      }
+      void increment()
+      {
+        myIndex = myMap->nextIndex( myIndex + 1 );
+        updateCell();
+      }
+      void updateCell()
+      {
+        if ( myMap != 0 && myIndex < myMap->myData.size() )
+          myCell = myMap->cellOfIndex( myIndex );
+      }
+
+      /// The visited map.
+      TMap* myMap;
+      /// The index of the visited cell in the arrays of the map.
+      size_type myIndex;
+      /// The visited cell.
+      Cell myCell;
+    };
+
+    typedef IteratorImpl< Self, reference >             iterator;
+    typedef IteratorImpl< const Self, const_reference > const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The map is empty and has no storage.
+     */
+    DenseCellMap();
+
+    /**
+     * Constructor. Allocates the storage for all the cells of
+     * dimension @a d of the space @a K.
+     * @param K any bounded Khalimsky space, referenced by the map.
+     * @param d the dimension of the cells of the map.
+     */
+    DenseCellMap( ConstAlias<KSpace> K, Dimension d );
+
+    /**
+     * (Re)allocates the storage for all the cells of dimension @a d of
+     * the space @a K. The map is empty afterwards.
+     * @param K any bounded Khalimsky space, referenced by the map.
+     * @param d the dimension of the cells of the map.
+     */
+    void init( ConstAlias<KSpace> K, Dimension d );
+
+    /// @return the number of cells of the map.
+    size_type size() const;
+    /// @return the maximal number of cells of the map, i.e. the number of cells of its dimension in the space.
+    size_type max_size() const;
+    /// @return 'true' iff the map has no cell.
+    bool empty() const;
+
+    /// Removes all the cells (the storage is kept).
+    void clear();
+    /// Swaps the content of this map and @a other.
+    /// @param other any other map.
+    void swap( Self & other );
+
+    // ----------------------- Associative container services ---------------
+  public:
+
+    /// @return an iterator on the first cell.
+    iterator begin();
+    /// @return an iterator after the last cell.
+    iterator end();
+    /// @return a const iterator on the first cell.
+    const_iterator begin() const;
+    /// @return a const iterator after the last cell.
+    const_iterator end() const;
+
+    /// @param c any cell.
+    /// @return an iterator on @a c if it belongs to the map, end() otherwise.
+    iterator find( const Cell & c );
+    /// @param c any cell.
+    /// @return a const iterator on @a c if it belongs to the map, end() otherwise.
+    const_iterator find( const Cell & c ) const;
+    /// @param c any cell.
+    /// @return 1 if @a c belongs to the map, 0 otherwise.
+    size_type count( const Cell & c ) const;
+    /// @param c any cell.
+    /// @return the range of cells equal to @a c (at most one).
+    std::pair<iterator, iterator> equal_range( const Cell & c );
+    /// @param c any cell.
+    /// @return the range of cells equal to @a c (at most one).
+    std::pair<const_iterator, const_iterator> equal_range( const Cell & c ) const;
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the map.
+     * @param v a pair (cell, data), the cell being within the space.
+     * @return an iterator on the cell, and 'true' iff it was inserted.
+     */
+    std::pair<iterator, bool> insert( const value_type & v );
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the map.
+     * @param hint an iterator, ignored.
+     * @param v a pair (cell, data), the cell being within the space.
+     * @return an iterator on the cell.
+     */
+    iterator insert( const_iterator hint, const value_type & v );
+
+    /**
+     * Inserts a range of pairs (cell, data).
+     * @param it an iterator on the first pair.
+     * @param itE an iterator after the last pair.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator it, InputIterator itE );
+
+    /**
+     * @param c any cell within the space.
+     * @return a reference to its data, the cell being inserted with
+     * the data Data() if it was not in the map.
+     * @throw InputException if @a c is outside of the map range.
+     */
+    Data & operator[]( const Cell & c );
+
+    /// @param c any cell.
+    /// @return the number of removed cells (0 or 1).
+    size_type erase( const Cell & c );
+    /// @param it any valid iterator on a cell of the map.
+    /// @return an iterator on the cell following the removed one.
+    iterator erase( const_iterator it );
+    /// Removes the cells of a range.
+    /// @param it an iterator on the first cell to remove.
+    /// @param itE an iterator after the last cell to remove.
+    /// @return @a itE as a mutable iterator.
+    iterator erase( const_iterator it, const_iterator itE );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The regular grid of cells having the same open directions.
+    struct Block {
+      size_type base;  ///< Index of the first cell of the block.
+      size_type count; ///< Number of cells of the block.
+      Point     first; ///< Khalimsky coordinates of the first cell.
+      Point     sizes; ///< Number of cells along each direction.
+    };
+
+    /// The Khalimsky space of the cells.
+    const KSpace* mySpace;
+    /// The dimension of the cells of the map.
+    Dimension myDim;
+    /// The blocks of cells, by increasing base.
+    std::vector<Block> myBlocks;
+    /// For each topology (bit k set if open along k), its block or -1.
+    std::vector<int> myBlockOfTopology;
+    /// The data of all the cells.
+    std::vector<Data> myData;
+    /// One bit per cell, set if the cell belongs to the map.
+    std::vector<DGtal::uint64_t> myBits;
+    /// The number of cells of the map.
+    size_type mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the value returned by indexOf for cells out of the map range.
+    static size_type npos() { return std::numeric_limits<size_type>::max(); }
+
+    /// @param c any cell.
+    /// @return its index in myData, or npos() if it cannot be stored.
+    size_type indexOf( const Cell & c ) const;
+
+    /// @param i the index of a cell in myData.
+    /// @return the cell.
+    Cell cellOfIndex( size_type i ) const;
+
+    /// @param i any index.
+    /// @return the index of the first cell of the map at or after @a i, or myData.size().
+    size_type nextIndex( size_type i ) const;
+
+    /// @param i any index.
+    /// @return 'true' iff the cell of index @a i belongs to the map.
+    bool isSet( size_type i ) const;
+
+  }; // end of class DenseCellMap
+
+  /// Defines container traits for DenseCellMap<>.
+  template < typename TKSpace, typename TData >
+  struct ContainerTraits< DenseCellMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  namespace detail {
+    /// Initializes the cell containers of a CubicalComplex with its space.
+    template < typename TKSpace, typename TData >
+    struct CubicalCellContainerInitializer< DenseCellMap< TKSpace, TData > >
+    {
+      static void init( DenseCellMap< TKSpace, TData > & cells,
+                        const TKSpace & K, Dimension d )
+      {
+        cells.init( K, d );
+      }
+    };
+  } // namespace detail
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap< TKSpace, TData > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
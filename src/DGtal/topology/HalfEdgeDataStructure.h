@@ -353,6 +353,33 @@ namespace DGtal
       return build( nbVtx, polygonal_faces, edges );
     }
 
+    /**
+     * Builds the half-edge data structure from polygonal faces given
+     * as two flat arrays: the vertices of face \a f are \a
+     * face_vertices[ \a face_offsets[ f ] ], ..., \a face_vertices[ \a
+     * face_offsets[ f+1 ] - 1 ].
+     *
+     * The result is identical to `build( polygonal_faces )` (same
+     * numbering of vertices, edges, half-edges and faces), but no
+     * per-face vector nor map is used during the construction: the
+     * arcs of all faces are sorted once, which brings twin arcs next
+     * to each other in the order of the edges, and all arrays are
+     * allocated at their final size. It is thus much faster on large
+     * meshes. Only the map from arcs to half-edges is filled at the
+     * end, from sorted arcs.
+     *
+     * @param[in] face_offsets the offsets of each face in \a
+     * face_vertices, with one more element equal to the size of \a
+     * face_vertices.
+     * @param[in] face_vertices the vertices of all faces, face after face.
+     *
+     * @return 'true' if everything went well, 'false' if their was
+     * error in the given topology (for instance, three faces
+     * sharing an edge).
+     */
+    bool buildFromFlatFaces( const std::vector<Index>&       face_offsets,
+                             const std::vector<VertexIndex>& face_vertices );
+
     /// Clears the data structure.
     void clear()
     {
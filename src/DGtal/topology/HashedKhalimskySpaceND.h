@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HashedKhalimskySpaceND.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HashedKhalimskySpaceND.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HashedKhalimskySpaceND_RECURSES)
+#error Recursive header files inclusion detected in HashedKhalimskySpaceND.h
+#else // defined(HashedKhalimskySpaceND_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HashedKhalimskySpaceND_RECURSES
+
+#if !defined HashedKhalimskySpaceND_h
+/** Prevents repeated inclusion of headers. */
+#define HashedKhalimskySpaceND_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <unordered_set>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HashedKhalimskySpaceND
+  /**
+   * Description of template class 'HashedKhalimskySpaceND' <p>
+   * \brief Aim: A Khalimsky space whose preferred cell containers are
+   * hash tables instead of ordered trees.
+   *
+   * KhalimskySpaceND rebinds its sets (CellSet, SCellSet, SurfelSet)
+   * to std::set and its maps (CellMap, SCellMap, SurfelMap) to
+   * std::map. Every algorithm that stores cells through these types
+   * (boundary tracking, digital surface containers, CubicalComplex,
+   * ...) thus pays a logarithmic number of lexicographic cell
+   * comparisons per query. This space has exactly the same cells,
+   * services and behavior as KhalimskySpaceND, but rebinds these
+   * types to std::unordered_set and std::unordered_map, hashed with
+   * the functions of KhalimskyCellHashFunctions.h. Queries and
+   * insertions then take expected constant time.
+   *
+   * The price to pay is that the cells of these containers are not
+   * visited in lexicographic order anymore. Algorithms that only
+   * query, insert or visit all the cells are not affected.
+   *
+   * @code
+   * typedef HashedKhalimskySpaceND< 3, DGtal::int32_t > KSpace;
+   * KSpace K;
+   * K.init( Z3i::Point( 0, 0, 0 ), Z3i::Point( 255, 255, 255 ), true );
+   * KSpace::SCellSet boundary;  // std::unordered_set< KSpace::SCell >
+   * CubicalComplex< KSpace > complex( K ); // hashed cells per dimension
+   * @endcode
+   *
+   * It is a model of concepts::CCellularGridSpaceND and can be used
+   * wherever a KhalimskySpaceND is expected.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   *
+   * @see KhalimskySpaceND
+   */
+  template <
+      Dimension dim,
+      typename TInteger = DGtal::int32_t
+  >
+  class HashedKhalimskySpaceND
+    : public KhalimskySpaceND< dim, TInteger >
+  {
+  public:
+    /// The Khalimsky space providing all the cellular services.
+    typedef KhalimskySpaceND< dim, TInteger > Base;
+
+    typedef typename Base::Integer Integer;
+    typedef typename Base::Cell    Cell;
+    typedef typename Base::SCell   SCell;
+    typedef typename Base::Surfel  Surfel;
+
+    typedef HashedKhalimskySpaceND< dim, TInteger > CellularGridSpace;
+
+    // Sets, Maps
+    /// Preferred type for defining a set of Cell(s).
+    typedef std::unordered_set<Cell> CellSet;
+
+    /// Preferred type for defining a set of SCell(s).
+    typedef std::unordered_set<SCell> SCellSet;
+
+    /// Preferred type for defining a set of surfels (always signed cells).
+    typedef std::unordered_set<SCell> SurfelSet;
+
+    /// Template rebinding for defining the type that is a mapping
+    /// Cell -> Value.
+    template <typename Value> struct CellMap {
+        typedef std::unordered_map<Cell,Value> Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SCellMap {
+        typedef std::unordered_map<SCell,Value> Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SurfelMap {
+        typedef std::unordered_map<SCell,Value> Type;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor, see KhalimskySpaceND::KhalimskySpaceND.
+    HashedKhalimskySpaceND() = default;
+
+    /**
+     * Constructor from a Khalimsky space. The returned space has the
+     * same bounds and closures as @a other.
+     * @param other the Khalimsky space to copy.
+     */
+    HashedKhalimskySpaceND( const Base & other )
+      : Base( other )
+    {}
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[Hashed";
+      Base::selfDisplay( out );
+      out << "]";
+    }
+
+  }; // end of class HashedKhalimskySpaceND
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HashedKhalimskySpaceND'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HashedKhalimskySpaceND' to write.
+   * @return the output stream after the writing.
+   */
+  template < Dimension dim, typename TInteger >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const HashedKhalimskySpaceND< dim, TInteger > & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HashedKhalimskySpaceND_h
+
+#undef HashedKhalimskySpaceND_RECURSES
+#endif // else defined(HashedKhalimskySpaceND_RECURSES)
@@ -41,12 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include <set>
 #include <map>
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/OwningOrAliasingPtr.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -272,6 +274,42 @@ namespace DGtal
     /// neighborhoods).
     bool build( ConstAlias< DigitalSurfaceContainer > surfContainer );
 
+    /// Builds the half-edge data structure directly from the sorted
+    /// surfels of the given digital surface container. After that,
+    /// the surface is valid.
+    ///
+    /// The vertices are numbered in the order of \a sortedSurfels and
+    /// the adjacencies of surfels are those of the set of surfels \a
+    /// sortedSurfels with the surfel adjacency of the container (as
+    /// in SetOfSurfels). The result is then identical to `build(
+    /// surfContainer )` for a SetOfSurfels with an ordered set of
+    /// surfels, but no DigitalSurface nor per-face storage is used:
+    /// the adjacent surfels of each surfel are found once by binary
+    /// search in \a sortedSurfels and stored in a flat table, faces
+    /// are computed with umbrellas over this table and sorted once,
+    /// and the half-edge data structure is built from flat arrays
+    /// (see HalfEdgeDataStructure::buildFromFlatFaces). The adjacency
+    /// table, the faces and the arcs are computed in parallel if a
+    /// thread pool is given.
+    ///
+    /// @param surfContainer any instance of digital surface
+    /// container. Pass a CountedPtr or any variant if you wish to
+    /// secure its aliasing.
+    ///
+    /// @param sortedSurfels the surfels of the container, sorted in
+    /// increasing order without duplicates. It is moved into the
+    /// object (pass it with std::move to avoid any copy).
+    ///
+    /// @param aThreadPool if not null, the pool used to parallelize
+    /// the construction.
+    ///
+    /// @return true if everything went allright, false if it was not
+    /// possible to build a consistent data structure (e.g., butterfly
+    /// neighborhoods) or if the surfels are not sorted.
+    bool build( ConstAlias< DigitalSurfaceContainer > surfContainer,
+                SCellStorage sortedSurfels,
+                ThreadPool * aThreadPool = nullptr );
+
     /**
        @return a const reference to the stored container.
     */
@@ -696,6 +734,79 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// Tells if a surfel belongs to sorted surfels, and remembers the
+    /// index of the last found surfel.
+    struct SortedSurfelsPredicate
+    {
+      typedef typename KSpace::Surfel Surfel;
+      const SCellStorage * surfels;
+      mutable VertexIndex  found;
+      bool operator()( const Surfel & s ) const
+      {
+        auto it = std::lower_bound( surfels->cbegin(), surfels->cend(), s );
+        found   = it - surfels->cbegin();
+        return ( it != surfels->cend() ) && ( *it == s );
+      }
+    };
+
+    /// A model of concepts::CDigitalSurfaceTracker over sorted
+    /// surfels, whose adjacent surfels are read in a table computed
+    /// beforehand (2*(n-1) entries per surfel, the entry 2*r+1-pos
+    /// being for the r-th direction of the surfel and orientation
+    /// pos). Used by the direct build.
+    struct SortedSurfelsTracker
+    {
+      typedef SortedSurfelsTracker     Self;
+      typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+      typedef typename KSpace::Surfel  Surfel;
+      static const Dimension stride = 2 * ( KSpace::dimension - 1 );
+
+      const DigitalSurfaceContainer * container;
+      const SCellStorage *             surfels;
+      const std::vector<VertexIndex> * neighbors;
+      const std::vector<uint8_t> *     codes;
+      VertexIndex         index;
+      Dimension           orth;
+      mutable VertexIndex lastAdjacent;
+
+      const DigitalSurfaceContainer & surface() const { return *container; }
+      const Surfel & current() const { return (*surfels)[ index ]; }
+      Dimension orthDir() const { return orth; }
+      /// Moves to the surfel of index \a i.
+      void moveTo( VertexIndex i )
+      {
+        index = i;
+        orth  = container->space().sOrthDir( current() );
+      }
+      void move( const Surfel & s )
+      {
+        if ( s == current() ) return;
+        if ( lastAdjacent != HALF_EDGE_INVALID_INDEX && s == (*surfels)[ lastAdjacent ] )
+          moveTo( lastAdjacent );
+        else
+          moveTo( std::lower_bound( surfels->cbegin(), surfels->cend(), s )
+                  - surfels->cbegin() );
+      }
+      /// @return the entry of the table for the surfel of index \a
+      /// i, of orthogonal direction \a o, along direction \a d and
+      /// orientation \a pos.
+      static Index slot( VertexIndex i, Dimension o, Dimension d, bool pos )
+      {
+        return i * stride + 2 * ( d > o ? d - 1 : d ) + ( pos ? 0 : 1 );
+      }
+      uint8_t adjacent( Surfel & s, Dimension d, bool pos ) const
+      {
+        const Index slot = Self::slot( index, orth, d, pos );
+        const uint8_t code = (*codes)[ slot ];
+        if ( code != 0 )
+          {
+            lastAdjacent = (*neighbors)[ slot ];
+            s = (*surfels)[ lastAdjacent ];
+          }
+        return code;
+      }
+    };
+
   private:
 
     // ------------------------- Internals ------------------------------------
@@ -0,0 +1,305 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellPacker.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module KhalimskyCellPacker.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellPacker_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellPacker.h
+#else // defined(KhalimskyCellPacker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellPacker_RECURSES
+
+#if !defined KhalimskyCellPacker_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellPacker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacker
+  /**
+   * Description of template class 'KhalimskyCellPacker' <p>
+   * \brief Aim: Packs the cells of a bounded Khalimsky space into
+   * 64-bit words, and provides the basic topological operations
+   * (incidence, adjacence, direct incidence, ...) as bit arithmetic
+   * on these words.
+   *
+   * A KhalimskyCell stores a whole point of Khalimsky coordinates
+   * and a SignedKhalimskyCell adds a sign, so that hashing or
+   * comparing cells reads every coordinate. In a bounded space,
+   * each Khalimsky coordinate only needs a few bits: the packer
+   * stores the k-th coordinate, shifted so that it starts at an even
+   * value, in a bit field of the code. The sign of a signed cell is
+   * the most significant bit of the code. Codes are thus plain
+   * integers, cheap to store, hash and compare.
+   *
+   * Since the shift keeps the parity of coordinates, the topology of
+   * a cell is read on the lowest bit of each field, and moving along
+   * the k-th axis adds or subtracts a constant to the code:
+   *
+   * @code
+   * typedef KhalimskyCellPacker< Z3i::KSpace > Packer;
+   * Packer packer( K );
+   * Packer::Code c = packer.pack( K.sCell( Point( 1, 2, 3 ) ) );
+   * Packer::Code d = packer.sDirectIncident( c, 0 ); // a face of c
+   * std::unordered_set< Packer::Code > marked;       // e.g. for tracking
+   * ASSERT( packer.unpackSCell( d ) == K.sDirectIncident( packer.unpackSCell( c ), 0 ) );
+   * @endcode
+   *
+   * Codes are unchecked: as the corresponding methods of
+   * KhalimskySpaceND, the operations on codes do not test the
+   * bounds of the space. The bit fields are large enough to encode
+   * cells up to one adjacency step outside of the bounds. Periodic
+   * spaces are not supported (isValid() returns false).
+   *
+   * @tparam TKSpace the type of cellular grid space, a model of
+   * concepts::CCellularGridSpaceND, e.g. KhalimskySpaceND.
+   */
+  template <typename TKSpace>
+  class KhalimskyCellPacker
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef KhalimskyCellPacker<TKSpace> Self;
+    typedef TKSpace                      KSpace;
+    typedef typename KSpace::Integer     Integer;
+    typedef typename KSpace::Point       Point;
+    typedef typename KSpace::Cell        Cell;
+    typedef typename KSpace::SCell       SCell;
+    typedef typename KSpace::Sign        Sign;
+    /// The type of packed (signed or unsigned) cells.
+    typedef DGtal::uint64_t              Code;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    /// The bit holding the sign of packed signed cells (set when positive).
+    static const Code SIGN_BIT = static_cast<Code>( 1 ) << 63;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The object is not valid.
+     */
+    KhalimskyCellPacker();
+
+    /**
+     * Constructor from a Khalimsky space.
+     * @param K any bounded Khalimsky space, referenced by the packer.
+     * @see init
+     */
+    KhalimskyCellPacker( ConstAlias<KSpace> K );
+
+    /**
+     * Computes the bit fields for the cells of the space @a K.
+     * @param K any bounded Khalimsky space, referenced by the packer.
+     * @return 'true' if all the cells of @a K fit in 63 bits and
+     * no dimension is periodic, 'false' otherwise.
+     */
+    bool init( ConstAlias<KSpace> K );
+
+    /// @return the Khalimsky space of the packed cells.
+    const KSpace & space() const;
+
+    /// @return the number of bits used to store the coordinates of cells.
+    unsigned int nbBits() const;
+
+    // ----------------------- Packing services -------------------------------
+  public:
+
+    /// @param c any cell of the space.
+    /// @return its code.
+    Code pack( const Cell & c ) const;
+
+    /// @param c any signed cell of the space.
+    /// @return its code.
+    Code pack( const SCell & c ) const;
+
+    /// @param code the code of an unsigned cell.
+    /// @return the corresponding cell.
+    Cell unpackCell( Code code ) const;
+
+    /// @param code the code of a signed cell.
+    /// @return the corresponding signed cell.
+    SCell unpackSCell( Code code ) const;
+
+    // ----------------------- Cell services ----------------------------------
+  public:
+
+    /// @param code the code of any cell.
+    /// @return its dimension, i.e. its number of open coordinates.
+    Dimension uDim( Code code ) const;
+
+    /// @param code the code of any cell.
+    /// @param k any valid dimension.
+    /// @return 'true' if the cell is open along the direction @a k.
+    bool uIsOpen( Code code, Dimension k ) const;
+
+    /// @param code the code of any cell.
+    /// @param k any valid dimension.
+    /// @return its k-th Khalimsky coordinate.
+    Integer uKCoord( Code code, Dimension k ) const;
+
+    /// @param code the code of any signed cell.
+    /// @return its sign.
+    static Sign sSign( Code code );
+
+    /// @param code the code of any signed cell.
+    /// @return the code of the same cell with the opposite sign.
+    static Code sOpp( Code code );
+
+    /// @param code the code of any signed cell.
+    /// @return the code of the unsigned version of the cell.
+    static Code unsigns( Code code );
+
+    /// @param code the code of any unsigned cell.
+    /// @param s the sign of the result.
+    /// @return the code of the signed version of the cell.
+    static Code signs( Code code, Sign s );
+
+    // ----------------------- Neighborhood services --------------------------
+  public:
+
+    /**
+     * @param code the code of any cell.
+     * @param k any valid dimension.
+     * @param up when 'true', the adjacent cell is after, otherwise before.
+     * @return the code of the cell adjacent to @a code along @a k
+     * (the sign, if any, is preserved).
+     */
+    Code uAdjacent( Code code, Dimension k, bool up ) const;
+
+    /**
+     * @param code the code of any cell.
+     * @param k any valid dimension.
+     * @param up when 'true', the incident cell is after, otherwise before.
+     * @return the code of the unsigned cell incident to @a code along @a k.
+     */
+    Code uIncident( Code code, Dimension k, bool up ) const;
+
+    /**
+     * @param code the code of any signed cell.
+     * @param k any valid dimension.
+     * @param up when 'true', the incident cell is after, otherwise before.
+     * @return the code of the signed cell incident to @a code along
+     * @a k, as KhalimskySpaceND::sIncident.
+     */
+    Code sIncident( Code code, Dimension k, bool up ) const;
+
+    /**
+     * @param code the code of any signed cell.
+     * @param k any valid dimension.
+     * @return the direct orientation of the cell along @a k, as
+     * KhalimskySpaceND::sDirect.
+     */
+    bool sDirect( Code code, Dimension k ) const;
+
+    /**
+     * @param code the code of any signed cell.
+     * @param k any valid dimension along which the cell is open.
+     * @return the code of the positive incident cell along the direct
+     * orientation, as KhalimskySpaceND::sDirectIncident.
+     */
+    Code sDirectIncident( Code code, Dimension k ) const;
+
+    /**
+     * @param code the code of any signed cell.
+     * @param k any valid dimension along which the cell is open.
+     * @return the code of the negative incident cell along the
+     * indirect orientation, as KhalimskySpaceND::sIndirectIncident.
+     */
+    Code sIndirectIncident( Code code, Dimension k ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The Khalimsky space of the packed cells.
+    const KSpace* mySpace;
+    /// Tells if the cells of the space fit in a code.
+    bool myValid;
+    /// Total number of bits of the coordinates.
+    unsigned int myNbBits;
+    /// Value subtracted to the k-th Khalimsky coordinate (even).
+    Integer myOffset[ dimension ];
+    /// Position of the bit field of the k-th coordinate.
+    unsigned int myShift[ dimension ];
+    /// Mask of the bit field of the k-th coordinate, once shifted to bit 0.
+    Code myMask[ dimension ];
+    /// Lowest bits of the fields of coordinates 0 to k.
+    Code myOddMasks[ dimension ];
+
+  }; // end of class KhalimskyCellPacker
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellPacker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellPacker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellPacker<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellPacker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellPacker_h
+
+#undef KhalimskyCellPacker_RECURSES
+#endif // else defined(KhalimskyCellPacker_RECURSES)
@@ -64,6 +64,9 @@ namespace DGtal {
    * At build or install time, the header
    * "DGtal/topology/tables/NeighborhoodTables.h" is generated.
    * It has const strings variables with the file names of the tables.
+   *
+   * @see NeighborhoodTableRegistry to load each table once per process
+   * and cache it uncompressed between runs.
    */
   inline
   DGtal::CountedPtr< boost::dynamic_bitset<> >
@@ -0,0 +1,253 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodTableRegistry.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module NeighborhoodTableRegistry.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NeighborhoodTableRegistry_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodTableRegistry.h
+#else // defined(NeighborhoodTableRegistry_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodTableRegistry_RECURSES
+
+#if !defined NeighborhoodTableRegistry_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodTableRegistry_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class NeighborhoodTableRegistry
+  /**
+   * Description of class 'NeighborhoodTableRegistry' <p>
+   * \brief Aim: Process-wide registry of the look-up tables of
+   * neighborhood configurations (simplicity, isthmusicity), loaded
+   * once and shared by all the Object and VoxelComplex instances.
+   *
+   * functions::loadTable decompresses and parses a table at each
+   * call, which takes a few hundred milliseconds for the 2^26 entries
+   * of 3D tables. The registry keeps the loaded tables, so that a
+   * table is loaded at most once per process, and may store them
+   * uncompressed in a cache directory, so that later processes read
+   * the bits of the table instead of decompressing it. The cache
+   * directory is given by setCacheDirectory or, by default, by the
+   * environment variable DGTAL_TABLES_CACHE (no cache if empty). A
+   * cached table is rebuilt if the size of its source file changed.
+   *
+   * The time spent to get each table, and where it came from, is
+   * kept and displayed by selfDisplay.
+   *
+   * @code
+   * auto table = NeighborhoodTableRegistry::table<3>( simplicity::tableSimple26_6 );
+   * VoxelComplex< KSpace > vc( K );
+   * vc.construct( set, table ); // shared with any other complex or object.
+   * trace.info() << NeighborhoodTableRegistry() << std::endl;
+   * @endcode
+   *
+   * All methods are thread-safe.
+   *
+   * @see functions::loadTable
+   */
+  class NeighborhoodTableRegistry
+  {
+    // ----------------------- Standard types ------------------------------
+  public:
+    /// The type of look-up tables.
+    typedef boost::dynamic_bitset<> ConfigMap;
+
+    /// How a table was obtained, with the time it took.
+    struct LoadingInfo
+    {
+      /// "compressed", "cache" or "uncompressed".
+      std::string source;
+      /// Loading time in milliseconds.
+      double time;
+      /// Number of requests of the table.
+      std::size_t nbRequests;
+    };
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Returns the table stored in @a input_filename, loading it if
+     * it is not already in the registry.
+     *
+     * @param input_filename the table file (see NeighborhoodTables.h).
+     * @param known_size the number of configurations, 256 in 2D and 2^26 in 3D.
+     * @param compressed true if the table file is compressed with zlib.
+     * @return the shared table.
+     */
+    static
+    CountedPtr< ConfigMap >
+    table( const std::string & input_filename, const unsigned int known_size,
+           const bool compressed = true );
+
+    /**
+     * Returns the table stored in @a input_filename for the given dimension.
+     *
+     * @tparam dimension of the space the table refers to, 2 or 3.
+     * @param input_filename the table file (see NeighborhoodTables.h).
+     * @param compressed true if the table file is compressed with zlib.
+     * @return the shared table.
+     */
+    template < unsigned int dimension = 3 >
+    static
+    CountedPtr< ConfigMap >
+    table( const std::string & input_filename, const bool compressed = true );
+
+    /**
+     * Sets the directory where uncompressed tables are cached (the
+     * directory must exist). An empty string disables the cache.
+     * @param directory the cache directory.
+     */
+    static void setCacheDirectory( const std::string & directory );
+
+    /// @return the directory where uncompressed tables are cached.
+    static std::string cacheDirectory();
+
+    /**
+     * @param input_filename a table file.
+     * @return the name of the file caching the table @a input_filename
+     * (empty if there is no cache directory).
+     */
+    static std::string cacheFilename( const std::string & input_filename );
+
+    /**
+     * @param input_filename a table file.
+     * @return the loading information of the table, with a source
+     * "none" if it has not been requested.
+     */
+    static LoadingInfo loadingInfo( const std::string & input_filename );
+
+    /// Removes all the tables from the registry (the tables still in
+    /// use are released when their last user releases them).
+    static void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the loaded tables with their loading times on
+     * the output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    /// A loaded table.
+    struct Entry
+    {
+      CountedPtr< ConfigMap > table;
+      LoadingInfo info;
+    };
+
+    /// The registry state.
+    struct State
+    {
+      std::mutex mutex;
+      std::map< std::string, Entry > entries;
+      std::string cacheDirectory;
+      State();
+    };
+
+    /// @return the process-wide state.
+    static State & state();
+
+    /**
+     * @param dir the cache directory.
+     * @param input_filename a table file.
+     * @return the name of the file caching the table in @a dir
+     * (empty if @a dir is empty).
+     */
+    static std::string cachePath( const std::string & dir,
+                                  const std::string & input_filename );
+
+    /**
+     * Reads a cached table.
+     * @param filename the cache file.
+     * @param source_size the size of the source file.
+     * @param[out] table the read table.
+     * @return true if the cache file exists and is valid.
+     */
+    static bool readCache( const std::string & filename,
+                           std::uint64_t source_size, ConfigMap & table );
+
+    /**
+     * Writes a table in the cache.
+     * @param filename the cache file.
+     * @param source_size the size of the source file.
+     * @param table the table.
+     */
+    static void writeCache( const std::string & filename,
+                            std::uint64_t source_size, const ConfigMap & table );
+
+  }; // end of class NeighborhoodTableRegistry
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NeighborhoodTableRegistry'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NeighborhoodTableRegistry' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const NeighborhoodTableRegistry & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodTableRegistry.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodTableRegistry_h
+
+#undef NeighborhoodTableRegistry_RECURSES
+#endif // else defined(NeighborhoodTableRegistry_RECURSES)
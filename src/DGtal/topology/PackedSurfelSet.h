@@ -0,0 +1,294 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedSurfelSet.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedSurfelSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedSurfelSet_RECURSES)
+#error Recursive header files inclusion detected in PackedSurfelSet.h
+#else // defined(PackedSurfelSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedSurfelSet_RECURSES
+
+#if !defined PackedSurfelSet_h
+/** Prevents repeated inclusion of headers. */
+#define PackedSurfelSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedSurfelSet
+  /**
+   * Description of template class 'PackedSurfelSet' <p>
+   * \brief Aim: A set of surfels (or of any signed cells) of a
+   * bounded Khalimsky space, stored as the 64-bit codes of a
+   * KhalimskyCellPacker in a flat hash table.
+   *
+   * A std::set<SCell> or std::unordered_set<SCell> allocates one node
+   * per cell, and compares or hashes whole signed cells. This set
+   * stores the codes of its cells in one array, with open addressing
+   * and linear probing, so that a query hashes and compares single
+   * integers in consecutive slots. The code 0 marks empty slots: it
+   * is the code of no cell within the bounds. Cells are converted at
+   * the interface of the set. It is meant as the surfel set of
+   * SetOfSurfels, and more generally of the digital surface
+   * containers parameterized by a surfel set:
+   *
+   * @code
+   * typedef PackedSurfelSet< KSpace >            SurfelSet;
+   * typedef SetOfSurfels< KSpace, SurfelSet >    SurfaceContainer;
+   * typedef DigitalSurface< SurfaceContainer >   Surface;
+   * SurfelSet surfels( K, boundary.begin(), boundary.end() );
+   * Surface surface( new SurfaceContainer( K, SurfelAdjacency<3>( true ), surfels ) );
+   * @endcode
+   *
+   * Iterators are read-only and return signed cells by value. As
+   * for std::unordered_set, insertions may invalidate them. Unlike
+   * std::unordered_set, erasing a cell may also move other cells,
+   * and so invalidates iterators.
+   *
+   * @warning The space must be bounded and not periodic, see
+   * KhalimskyCellPacker. Only cells within the bounds of the space
+   * can be inserted. Cells outside the bounds are never found.
+   *
+   * @tparam TKSpace the type of cellular grid space, a model of
+   * concepts::CCellularGridSpaceND, e.g. KhalimskySpaceND.
+   */
+  template <typename TKSpace>
+  class PackedSurfelSet
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef PackedSurfelSet<TKSpace>      Self;
+    typedef TKSpace                       KSpace;
+    typedef KhalimskyCellPacker<KSpace>   Packer;
+    typedef typename Packer::Code         Code;
+    typedef typename KSpace::SCell        SCell;
+    typedef SCell                         Surfel;
+
+    typedef SCell                         key_type;
+    typedef SCell                         value_type;
+    typedef std::size_t                   size_type;
+    typedef std::ptrdiff_t                difference_type;
+
+    /// Forward iterator on the cells of the set, returned by value.
+    class const_iterator
+      : public boost::iterator_facade< const_iterator, SCell,
+                                       std::forward_iterator_tag, SCell >
+    {
+    public:
+      /// Default (invalid) constructor.
+      const_iterator() : mySet( 0 ), myIndex( 0 ) {}
+      /// Constructor from a set and the index of a non-empty slot (or the end index).
+      const_iterator( const Self* set, size_type index ) : mySet( set ), myIndex( index ) {}
+
+    private:
+      friend class boost::iterator_core_access;
+
+      SCell dereference() const
+      {
+        return mySet->myPacker.unpackSCell( mySet->mySlots[ myIndex ] );
+      }
+      bool equal( const const_iterator & other ) const
+      {
+        return mySet == other.mySet && myIndex == other.myIndex;
+      }
+      void increment()
+      {
+        myIndex = mySet->nextSlot( myIndex + 1 );
+      }
+
+      /// The visited set.
+      const Self* mySet;
+      /// The index of the slot of the visited cell.
+      size_type myIndex;
+    };
+
+    typedef const_iterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The set is not valid.
+     */
+    PackedSurfelSet();
+
+    /**
+     * Constructor of an empty set.
+     * @param K any bounded Khalimsky space, referenced by the set.
+     */
+    PackedSurfelSet( ConstAlias<KSpace> K );
+
+    /**
+     * Constructor from a range of signed cells.
+     * @param K any bounded Khalimsky space, referenced by the set.
+     * @param it an iterator on the first cell.
+     * @param itE an iterator after the last cell.
+     */
+    template <typename InputIterator>
+    PackedSurfelSet( ConstAlias<KSpace> K, InputIterator it, InputIterator itE );
+
+    /**
+     * Empties the set and packs its cells for the space @a K.
+     * @param K any bounded Khalimsky space, referenced by the set.
+     * @return 'true' if the cells of @a K can be packed, see
+     * KhalimskyCellPacker::init.
+     */
+    bool init( ConstAlias<KSpace> K );
+
+    /// @return the packer converting the cells of the set.
+    const Packer & packer() const;
+
+    /// @return the number of cells of the set.
+    size_type size() const;
+    /// @return 'true' iff the set has no cell.
+    bool empty() const;
+    /// Removes all the cells (the storage is kept).
+    void clear();
+    /// Allocates the storage for @a n cells without rehashing.
+    /// @param n any number of cells.
+    void reserve( size_type n );
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /// @return an iterator on the first cell.
+    const_iterator begin() const;
+    /// @return an iterator after the last cell.
+    const_iterator end() const;
+
+    /// @param c any signed cell.
+    /// @return an iterator on @a c if it belongs to the set, end() otherwise.
+    const_iterator find( const SCell & c ) const;
+    /// @param c any signed cell.
+    /// @return 1 if @a c belongs to the set, 0 otherwise.
+    size_type count( const SCell & c ) const;
+
+    /**
+     * Inserts a cell, if it is not already in the set.
+     * @param c a signed cell within the space.
+     * @return an iterator on the cell, and 'true' iff it was inserted.
+     */
+    std::pair<const_iterator, bool> insert( const SCell & c );
+
+    /**
+     * Inserts a range of signed cells within the space.
+     * @param it an iterator on the first cell.
+     * @param itE an iterator after the last cell.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator it, InputIterator itE );
+
+    /// @param c any signed cell.
+    /// @return the number of removed cells (0 or 1).
+    size_type erase( const SCell & c );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The packer of the cells of the space.
+    Packer myPacker;
+    /// The codes of the cells of the set, 0 for empty slots.
+    std::vector<Code> mySlots;
+    /// The number of cells of the set.
+    size_type mySize;
+    /// The shift giving a slot from the high bits of a hashed code.
+    unsigned int myHashShift;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @param code the code of any cell.
+    /// @return its home slot.
+    size_type homeSlot( Code code ) const;
+
+    /// @param code the code of any cell.
+    /// @return the slot of @a code, or the empty slot where it would be inserted.
+    size_type slotOf( Code code ) const;
+
+    /// @param i any index.
+    /// @return the first non-empty slot at or after @a i, or the number of slots.
+    size_type nextSlot( size_type i ) const;
+
+    /// Rehashes the codes of the set into @a n slots.
+    /// @param n a power of two, larger than twice the size of the set.
+    void rehash( size_type n );
+
+  }; // end of class PackedSurfelSet
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedSurfelSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedSurfelSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedSurfelSet<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedSurfelSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedSurfelSet_h
+
+#undef PackedSurfelSet_RECURSES
+#endif // else defined(PackedSurfelSet_RECURSES)
@@ -40,6 +40,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include "boost/dynamic_bitset.hpp"
+#include <DGtal/base/ThreadPool.h>
 #include <DGtal/kernel/sets/DigitalSetBySTLSet.h>
 #include <DGtal/topology/CubicalComplex.h>
 #include <DGtal/topology/DigitalTopology.h>
@@ -471,6 +472,27 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
                                         const Parent &cubical,
                                         bool verbose = false) const;
 
+    /**
+     * Parallel version of @ref criticalCliquesForD using a ThreadPool,
+     * available without OpenMP. The cells of dimension d of \b cubical
+     * are split into chunks dynamically dispatched to the threads of
+     * the pool. The cliques of each chunk are gathered in chunk order,
+     * so that the result is the same as the sequential version,
+     * whatever the number of threads.
+     *
+     * @param d dimension of cell.
+     * @param cubical target complex to get critical cliques.
+     * @param pool the thread pool computing the cliques.
+     * @param verbose print messages
+     *
+     * @return CliqueContainer with the computed cliques for the specified
+     * dimension.
+     */
+    CliqueContainer criticalCliquesForD(const Dimension d,
+                                        const Parent &cubical,
+                                        ThreadPool &pool,
+                                        bool verbose = false) const;
+
     /**
      * Compute the criticality of the surfel between A,B voxels and
      * returns the associated 2-clique.
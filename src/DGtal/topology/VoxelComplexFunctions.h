@@ -43,12 +43,22 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/topology/BorderQueueThinning.h"
 #include "DGtal/topology/VoxelComplex.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace DGtal
 {
   namespace functions {
 
+    /*
+     * Thinning schemes based on critical kernels.
+     *
+     * If @a aThreadPool is not null, the critical cliques and the Skel
+     * predicate are computed by the threads of the pool (Skel must then
+     * be thread-safe, as the skel functions below). The result is the
+     * same as the sequential scheme for deterministic Select functions.
+     */
     template < typename TComplex >
     TComplex
     asymetricThinningScheme(
@@ -62,7 +72,8 @@ namespace DGtal
          const TComplex & ,
          const typename TComplex::Cell & )
        > Skel,
-       bool verbose = false
+       bool verbose = false,
+       ThreadPool * aThreadPool = nullptr
     );
 
     template < typename TComplex >
@@ -79,6 +90,46 @@ namespace DGtal
          const typename TComplex::Cell & )
        > Skel,
        uint32_t persistence,
+       bool verbose = false,
+       ThreadPool * aThreadPool = nullptr
+    );
+
+    /**
+     * Sequential thinning of a voxel complex driven by a queue of
+     * border voxels (see functions::borderQueueThinning for objects).
+     *
+     * Only the voxels having a neighbor voxel outside the complex are
+     * examined at start, and the 26 neighbors of each removed voxel
+     * are examined again, layer by layer, so that the cost is
+     * proportional to the number of removed voxels instead of the
+     * number of passes times the number of voxels. A simple voxel is
+     * removed unless Skel returns true when it is examined, in which
+     * case it is kept in the skeleton.
+     *
+     * Simplicity is computed with VoxelComplex::isSimple, which reads
+     * the simplicity table of the complex if it is loaded
+     * (VoxelComplex::setSimplicityTable, strongly advised).
+     *
+     * @tparam TComplex VoxelComplex type.
+     * @tparam TOutputIterator an output iterator on cells.
+     * @param vc input voxel complex.
+     * @param Skel the predicate selecting the voxels of the skeleton
+     * (e.g. skelUltimate, skelEnd, skelWithTable).
+     * @param removedVoxels receives the removed voxels, in their removal order.
+     * @param verbose print messages.
+     *
+     * @return the closed voxel complex of the remaining voxels.
+     */
+    template < typename TComplex, typename TOutputIterator >
+    TComplex
+    borderQueueThinningScheme(
+       const TComplex & vc ,
+       std::function<
+       bool(
+         const TComplex & ,
+         const typename TComplex::Cell & )
+       > Skel,
+       TOutputIterator removedVoxels,
        bool verbose = false
     );
 //////////////////////////////////////////////////////////////////////////////
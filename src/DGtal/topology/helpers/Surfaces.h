@@ -41,8 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
 
@@ -776,6 +781,141 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Computes the sorted vector of the unsigned surfels of the
+       boundary of a digital shape described by the predicate [pp],
+       that is the same cells as uMakeBoundary, in the same order as
+       a std::set<Cell>.
+
+       The domain is cut into slabs along the last axis, which are
+       scanned line by line by the threads of @a aThreadPool (each
+       point is compared with its successor along each axis). The
+       surfels of each slab are sorted in parallel, then the sorted
+       slabs are merged. The predicate is thus called concurrently
+       and must be thread-safe for const calls (e.g. a SetPredicate
+       or an image read).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param aBoundary (modified) the sorted vector of surfels.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+       @param aThreadPool if not null, the thread pool scanning the
+       slabs, otherwise the scan is sequential.
+    */
+    template <typename PointPredicate >
+    static
+    void uParallelMakeBoundary( std::vector<Cell> & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound,
+                                const Point & aUpperBound,
+                                ThreadPool * aThreadPool = nullptr );
+
+    /**
+       Computes the sorted vector of the signed surfels of the
+       boundary of a digital shape described by the predicate [pp],
+       that is the same cells as sMakeBoundary, in the same order as
+       a std::set<SCell>.
+
+       @see uParallelMakeBoundary for the slab decomposition.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param aBoundary (modified) the sorted vector of surfels.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+       @param aThreadPool if not null, the thread pool scanning the
+       slabs, otherwise the scan is sequential.
+    */
+    template <typename PointPredicate >
+    static
+    void sParallelMakeBoundary( std::vector<SCell> & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound,
+                                const Point & aUpperBound,
+                                ThreadPool * aThreadPool = nullptr );
+
+    /**
+       Computes, in a single scan of a label image, the signed surfels
+       separating two voxels of different labels, grouped by pair of
+       labels. The surfels between labels \a a < \a b are oriented
+       as the boundary of the region of label \a a (i.e. as
+       sMakeBoundary with the predicate "label == a"), so the boundary
+       of the region of label \a b is made of the opposite surfels.
+       As for sMakeBoundary, there are no surfels on the border of the
+       image domain.
+
+       This replaces one binarization and one boundary extraction per
+       label: each voxel is compared to its next neighbor along each
+       axis by linear index in the image buffer.
+
+       @code
+       std::map< std::pair< int, int >, std::vector< SCell > > bdries;
+       Surfaces< KSpace >::sMakeLabelBoundaries( bdries, K, labels );
+       // bdries[ { 1, 3 } ] is the sorted interface between labels 1 and 3.
+       @endcode
+
+       @tparam TDomain the domain of the image (a HyperRectDomain).
+       @tparam TValue the type of labels (with a total order).
+
+       @param aBoundaries (modified) cleared then filled with, for each
+       pair of labels (a,b) with a < b in contact, the sorted vector of
+       the surfels between them.
+       @param aKSpace any space containing the image domain.
+       @param anImage the label image.
+    */
+    template <typename TDomain, typename TValue>
+    static
+    void sMakeLabelBoundaries
+    ( std::map< std::pair< TValue, TValue >, std::vector<SCell> > & aBoundaries,
+      const KSpace & aKSpace,
+      const ImageContainerBySTLVector< TDomain, TValue > & anImage );
+
+    /**
+       Splits the boundary of a digital shape into its connected
+       components, as extractAllConnectedSCell (same components, in
+       the same order, with sorted surfels), without tracking them one
+       after the other.
+
+       The boundary is extracted with sParallelMakeBoundary, the
+       adjacent surfels of each surfel (given by SurfelNeighborhood)
+       are searched in the sorted boundary in parallel, then the
+       components are the classes of a union-find on these adjacencies.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param aVectConnectedSCell (modified) a vector containing for
+       each connected component the sorted vector of its surfels.
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency chosen for the components.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param forceOrientCellExterior if 'true', surfels are oriented
+       toward the exterior (see extractAllConnectedSCell).
+       @param aThreadPool if not null, the thread pool used for the
+       boundary extraction and the adjacencies.
+    */
+    template <typename PointPredicate >
+    static
+    void parallelExtractAllConnectedSCell
+    ( std::vector< std::vector<SCell> > & aVectConnectedSCell,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      bool forceOrientCellExterior = false,
+      ThreadPool * aThreadPool = nullptr );
     
 
     
@@ -914,6 +1054,35 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Scans the domain [aLowerBound, aUpperBound] by slabs along the
+       last axis and returns the sorted vector of the boundary cells
+       built by @a makeCell.
+
+       @tparam TCell the type of cells (Cell or SCell).
+       @tparam PointPredicate a model of concepts::CPointPredicate.
+       @tparam CellMaker a functor (const Cell & spel, Dimension k,
+       bool in_here) -> TCell returning the surfel between @a spel and
+       its successor along axis k, @a in_here telling if @a spel is
+       in the shape.
+
+       @param aBoundary (modified) the sorted vector of cells.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound the bounds of the scan.
+       @param aThreadPool if not null, the thread pool scanning the slabs.
+       @param makeCell the functor building the cells.
+    */
+    template <typename TCell, typename PointPredicate, typename CellMaker>
+    static
+    void parallelScanBoundary( std::vector<TCell> & aBoundary,
+                               const KSpace & aKSpace,
+                               const PointPredicate & pp,
+                               const Point & aLowerBound,
+                               const Point & aUpperBound,
+                               ThreadPool * aThreadPool,
+                               const CellMaker & makeCell );
+
   }; // end of class Surfaces
 
 
@@ -0,0 +1,101 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testThreadPool.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ThreadPool.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ThreadPool.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ThreadPool" )
+{
+  const std::size_t n = 100000;
+
+  SECTION("Each task is processed exactly once")
+    {
+      for ( unsigned int nbThreads : { 1u, 2u, 4u } )
+        {
+          ThreadPool pool( nbThreads );
+          REQUIRE( pool.size() == nbThreads );
+          std::vector<int> count( n, 0 );
+          pool.parallelFor( n, [&] ( std::size_t i ) { count[ i ] += 1; } );
+          REQUIRE( std::accumulate( count.begin(), count.end(), 0 ) == (int)n );
+          REQUIRE( std::count( count.begin(), count.end(), 1 ) == (long)n );
+        }
+    }
+
+  SECTION("Pool is reusable and ranks are valid")
+    {
+      ThreadPool pool( 3 );
+      for ( int run = 0; run < 50; ++run )
+        {
+          std::vector<std::size_t> perThread( pool.size(), 0 );
+          pool.parallelForWithRank( 1000, [&] ( std::size_t i, unsigned int rank )
+                                    { perThread[ rank ] += i; } );
+          REQUIRE( std::accumulate( perThread.begin(), perThread.end(), (std::size_t)0 )
+                   == 999 * 1000 / 2 );
+        }
+    }
+
+  SECTION("Nested loops are sequential")
+    {
+      ThreadPool pool( 2 );
+      std::vector<int> count( 100, 0 );
+      pool.parallelFor( 10, [&] ( std::size_t i )
+        {
+          pool.parallelFor( 10, [&] ( std::size_t j ) { count[ 10 * i + j ] += 1; } );
+        } );
+      REQUIRE( std::count( count.begin(), count.end(), 1 ) == 100 );
+    }
+
+  SECTION("Exceptions are forwarded to the caller")
+    {
+      ThreadPool pool( 2 );
+      REQUIRE_THROWS_AS( pool.parallelFor( 100, [] ( std::size_t i )
+                                           { if ( i == 42 ) throw std::runtime_error( "42" ); } ),
+                         std::runtime_error );
+      // The pool is still usable.
+      std::vector<int> count( 10, 0 );
+      pool.parallelFor( 10, [&] ( std::size_t i ) { count[ i ] = 1; } );
+      REQUIRE( std::count( count.begin(), count.end(), 1 ) == 10 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
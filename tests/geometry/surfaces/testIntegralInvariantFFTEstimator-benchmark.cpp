@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of IntegralInvariantFFTEstimator against the convolver
+ * based IntegralInvariantVolumeEstimator and
+ * IntegralInvariantCovarianceEstimator, for increasing kernel radii.
+ *
+ * Usage: testIntegralInvariantFFTEstimator-benchmark [gridstep] [maxRadius]
+ * (default: goursat shape at gridstep 0.25, digital radii up to 16).
+ * For each radius, the timings of both estimators are reported, so that
+ * the radius from which the FFT is faster can be read.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>         SH3;
+typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+typedef SH3::BinaryImage               BinaryImage;
+typedef SH3::SurfelRange               SurfelRange;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs the estimator @a TEstimator with the functor @a TFunctor on
+ * the surfels, reports its timing and returns the estimations in
+ * @a result.
+ */
+template <typename TEstimator, typename TFunctor, typename TQuantity>
+double run( const std::string & name, const Z3i::KSpace & K,
+            const BinaryImage & shape, const SurfelRange & surfels,
+            double h, double r, std::vector<TQuantity> & result )
+{
+  TFunctor functor;
+  functor.init( h, r*h );
+  Clock c;
+  c.startClock();
+  TEstimator estimator( functor );
+  estimator.attach( K, shape );
+  estimator.setParams( r );
+  estimator.init( h, surfels.begin(), surfels.end() );
+  result.clear();
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( result ) );
+  const double t = c.stopClock();
+  trace.info() << "  " << name << ": " << t << " ms ("
+               << surfels.size() / t * 1000.0 << " surfels/s)" << std::endl;
+  return t;
+}
+
+/**
+ * Compares both estimators on a goursat shape digitized at gridstep
+ * @a h, for digital radii from 1 to @a maxRadius, by factors of sqrt(2).
+ */
+bool runBenchmark( double h, double maxRadius )
+{
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space>     MeanFunctor;
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> GaussianFunctor;
+  typedef IntegralInvariantVolumeEstimator<Z3i::KSpace, BinaryImage, MeanFunctor>         MeanConvolver;
+  typedef IntegralInvariantFFTEstimator<Z3i::KSpace, BinaryImage, MeanFunctor>            MeanFFT;
+  typedef IntegralInvariantCovarianceEstimator<Z3i::KSpace, BinaryImage, GaussianFunctor> GaussianConvolver;
+  typedef IntegralInvariantFFTEstimator<Z3i::KSpace, BinaryImage, GaussianFunctor>        GaussianFFT;
+
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", h );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  trace.info() << "Domain " << K.lowerBound() << " " << K.upperBound()
+               << ", " << surfels.size() << " surfels" << std::endl;
+
+  bool ok = true;
+  for ( int k = 0; std::pow( 2.0, 0.5 * k ) <= maxRadius * ( 1.0 + 1e-9 ); ++k )
+    {
+      const double r = std::pow( 2.0, 0.5 * k );
+      trace.info() << "Digital radius " << r << std::endl;
+      std::vector<double> H1, H2, G1, G2;
+      const double t1 = run<MeanConvolver, MeanFunctor>
+        ( "Mean curvature, convolver", K, *binary_image, surfels, h, r, H1 );
+      const double t2 = run<MeanFFT, MeanFunctor>
+        ( "Mean curvature, FFT      ", K, *binary_image, surfels, h, r, H2 );
+      const double t3 = run<GaussianConvolver, GaussianFunctor>
+        ( "Gaussian curvature, convolver", K, *binary_image, surfels, h, r, G1 );
+      const double t4 = run<GaussianFFT, GaussianFunctor>
+        ( "Gaussian curvature, FFT      ", K, *binary_image, surfels, h, r, G2 );
+      trace.info() << "  Speedup: " << t1 / t2 << " (volume), "
+                   << t3 / t4 << " (covariance)" << std::endl;
+
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        ok = ok && std::abs( H1[ i ] - H2[ i ] ) <= 1e-8 * std::max( 1.0, std::abs( H1[ i ] ) )
+                && std::abs( G1[ i ] - G2[ i ] ) <= 1e-6 * std::max( 1.0, std::abs( G1[ i ] ) );
+    }
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking IntegralInvariantFFTEstimator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const double h         = argc > 1 ? atof( argv[ 1 ] ) : 0.25;
+  const double maxRadius = argc > 2 ? atof( argv[ 2 ] ) : 16.0;
+
+  bool res = runBenchmark( h, maxRadius );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class IntegralInvariantFFTEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>         SH3;
+typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IntegralInvariantFFTEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing IntegralInvariantFFTEstimator" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters() |  SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1. );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  const double h       = 1.0;
+
+  typedef SH3::BinaryImage BinaryImage;
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space>       MeanFunctor;
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space>   GaussianFunctor;
+  typedef functors::IINormalDirectionFunctor<Z3i::Space>       NormalFunctor;
+
+  SECTION( "Volume moments match IntegralInvariantVolumeEstimator" )
+    {
+      for ( double r : { 3.0, 5.5 } )
+        {
+          MeanFunctor functor;
+          functor.init( h, r*h );
+          IntegralInvariantVolumeEstimator<Z3i::KSpace, BinaryImage, MeanFunctor> convolver( functor );
+          convolver.attach( K, *binary_image );
+          convolver.setParams( r );
+          convolver.init( h, surfels.begin(), surfels.end() );
+          IntegralInvariantFFTEstimator<Z3i::KSpace, BinaryImage, MeanFunctor> fft( functor );
+          fft.attach( K, *binary_image );
+          fft.setParams( r );
+          fft.init( h, surfels.begin(), surfels.end() );
+          REQUIRE( fft.isValid() );
+
+          std::vector<double> H1, H2;
+          convolver.eval( surfels.begin(), surfels.end(), std::back_inserter( H1 ) );
+          fft.eval( surfels.begin(), surfels.end(), std::back_inserter( H2 ) );
+          REQUIRE( H1.size() == H2.size() );
+          for ( std::size_t i = 0; i < H1.size(); ++i )
+            REQUIRE( H2[ i ] == Approx( H1[ i ] ) );
+        }
+    }
+
+  SECTION( "Covariance moments match IntegralInvariantCovarianceEstimator" )
+    {
+      for ( double r : { 3.0, 5.5 } )
+        {
+          GaussianFunctor functor;
+          functor.init( h, r*h );
+          IntegralInvariantCovarianceEstimator<Z3i::KSpace, BinaryImage, GaussianFunctor> convolver( functor );
+          convolver.attach( K, *binary_image );
+          convolver.setParams( r );
+          convolver.init( h, surfels.begin(), surfels.end() );
+          IntegralInvariantFFTEstimator<Z3i::KSpace, BinaryImage, GaussianFunctor> fft( functor );
+          fft.attach( K, *binary_image );
+          fft.setParams( r );
+          fft.init( h, surfels.begin(), surfels.end() );
+
+          std::vector<double> G1, G2;
+          convolver.eval( surfels.begin(), surfels.end(), std::back_inserter( G1 ) );
+          fft.eval( surfels.begin(), surfels.end(), std::back_inserter( G2 ) );
+          REQUIRE( G1.size() == G2.size() );
+          for ( std::size_t i = 0; i < G1.size(); ++i )
+            REQUIRE( G2[ i ] == Approx( G1[ i ] ).margin( 1e-8 ) );
+
+          NormalFunctor nfunctor;
+          nfunctor.init( h, r*h );
+          IntegralInvariantCovarianceEstimator<Z3i::KSpace, BinaryImage, NormalFunctor> nconvolver( nfunctor );
+          nconvolver.attach( K, *binary_image );
+          nconvolver.setParams( r );
+          nconvolver.init( h, surfels.begin(), surfels.end() );
+          IntegralInvariantFFTEstimator<Z3i::KSpace, BinaryImage, NormalFunctor> nfft( nfunctor );
+          nfft.attach( K, *binary_image );
+          nfft.setParams( r );
+          nfft.init( h, surfels.begin(), surfels.end() );
+          for ( auto it = surfels.begin(); it != surfels.end(); ++it )
+            REQUIRE( std::abs( nfft.eval( it ).dot( nconvolver.eval( it ) ) ) == Approx( 1.0 ) );
+        }
+    }
+
+  SECTION( "II-method parameter of ShortcutsGeometry" )
+    {
+      params( "r-radius", 3.0 )( "II-method", "convolver" );
+      auto H1 = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+      auto T1 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+      params( "II-method", "fft" )( "threads", 2 );
+      auto H2 = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+      auto T2 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+      REQUIRE( H2.size() == surfels.size() );
+      REQUIRE( T2.size() == surfels.size() );
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        {
+          REQUIRE( H2[ i ] == Approx( H1[ i ] ) );
+          REQUIRE( std::get<0>( T2[ i ] ) == Approx( std::get<0>( T1[ i ] ) ).margin( 1e-8 ) );
+          REQUIRE( std::get<1>( T2[ i ] ) == Approx( std::get<1>( T1[ i ] ) ).margin( 1e-8 ) );
+        }
+    }
+}
+
+/** @ingroup Tests **/
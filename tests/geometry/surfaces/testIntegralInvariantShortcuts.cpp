@@ -86,4 +86,43 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
   }
 }
 
+TEST_CASE( "Testing multithreaded IntegralInvariant Shortcuts" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters() |  SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1. )( "r-radius", 3.0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+
+  params( "threads", 1 );
+  auto H1 = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+  auto G1 = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+  auto N1 = SHG3::getIINormalVectors( binary_image, surfels, params );
+  auto T1 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+  params( "threads", 4 );
+  auto H4 = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+  auto G4 = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+  auto N4 = SHG3::getIINormalVectors( binary_image, surfels, params );
+  auto T4 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+
+  SECTION("Testing that estimations do not depend on the number of threads")
+  {
+    REQUIRE( H4.size() == surfels.size() );
+    REQUIRE( G4.size() == surfels.size() );
+    REQUIRE( N4.size() == surfels.size() );
+    REQUIRE( T4.size() == surfels.size() );
+    for ( std::size_t i = 0; i < surfels.size(); ++i )
+      {
+        REQUIRE( H4[ i ] == Approx( H1[ i ] ) );
+        REQUIRE( G4[ i ] == Approx( G1[ i ] ) );
+        REQUIRE( N4[ i ].dot( N1[ i ] ) == Approx( 1.0 ) );
+        REQUIRE( std::get<0>( T4[ i ] ) == Approx( std::get<0>( T1[ i ] ) ) );
+        REQUIRE( std::get<1>( T4[ i ] ) == Approx( std::get<1>( T1[ i ] ) ) );
+      }
+  }
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,159 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompactSiteImage.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class CompactSiteImage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CompactSiteImage.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompactSiteImage.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing CompactSiteImage" )
+{
+  typedef CompactSiteImage<Z3i::Domain> LinearImage;
+  typedef CompactSiteImage<Z3i::Domain, OffsetSiteEncoder<Z3i::Domain> > OffsetImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< LinearImage > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< OffsetImage > ));
+
+  Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 20, 17, 30 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 0 );
+  for ( auto const & p : domain )
+    if ( rand() % 200 != 0 )
+      set.insertNew( p );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  L2Metric l2;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+
+  SECTION("Encoding and decoding sites")
+    {
+      LinearImage linear( domain );
+      OffsetImage offset( domain );
+      const Z3i::Point infinity = Z3i::Point::diagonal( NumberTraits<Z3i::Integer>::max() );
+      REQUIRE( linear( Z3i::Point( 0, 0, 2 ) ) == infinity );
+      REQUIRE( offset( Z3i::Point( 0, 0, 2 ) ) == infinity );
+      linear.setValue( Z3i::Point( 0, 0, 2 ), Z3i::Point( 20, 17, 30 ) );
+      offset.setValue( Z3i::Point( 0, 0, 2 ), Z3i::Point( 40, -17, 30 ) );
+      REQUIRE( linear( Z3i::Point( 0, 0, 2 ) ) == Z3i::Point( 20, 17, 30 ) );
+      REQUIRE( offset( Z3i::Point( 0, 0, 2 ) ) == Z3i::Point( 40, -17, 30 ) );
+      REQUIRE( linear.memorySize() == domain.size() * 4 );
+      REQUIRE( offset.memorySize() == domain.size() * 6 );
+      REQUIRE( linear.isValid() );
+    }
+
+  SECTION("Domains too large for the codes are rejected")
+    {
+      typedef CompactSiteImage<Z3i::Domain, LinearIndexSiteEncoder<Z3i::Domain, DGtal::uint16_t> > ShortLinearImage;
+      // 26 * 18 * 29 points, indexed by 16 bits.
+      REQUIRE_NOTHROW( ShortLinearImage( domain ) );
+      REQUIRE_THROWS_AS( ShortLinearImage( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 255, 255, 0 ) ) ),
+                         InputException );
+      REQUIRE_NOTHROW( OffsetImage( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 32766, 0, 0 ) ) ) );
+      REQUIRE_THROWS_AS( OffsetImage( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 32767, 0, 0 ) ) ),
+                         InputException );
+      REQUIRE_THROWS_AS( OffsetSiteEncoder<Z3i::Domain>( Z3i::Domain( Z3i::Point( 0, -40000, 0 ), Z3i::Point( 0, 0, 0 ) ) ),
+                         InputException );
+    }
+
+  SECTION("DistanceTransformation with linear index storage")
+    {
+      DT dt( domain, set, l2 );
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric, LinearImage> dtCompact( domain, set, l2 );
+      unsigned int nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( dt.getVoronoiVector( p ) == dtCompact.getVoronoiVector( p )
+                  && dt( p ) == dtCompact( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+
+  SECTION("Periodic VoronoiMap with offset storage")
+    {
+      const std::array<bool, 3> periodicity = {{ true, false, true }};
+      VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> voro( domain, set, l2, periodicity );
+      VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, OffsetImage> voroCompact( domain, set, l2, periodicity );
+      unsigned int nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( voro( p ) == voroCompact( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+
+  SECTION("ReverseDistanceTransformation and ReducedMedialAxis with linear index storage")
+    {
+      typedef ExactPredicateLpPowerSeparableMetric<Z3i::Space, 2> L2PowerMetric;
+      typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> Weights;
+      L2PowerMetric l2power;
+
+      // Squared distances of a ball.
+      Weights weights( domain );
+      for ( auto const & p : domain )
+        {
+          const DGtal::int64_t d = 36 - ( p - Z3i::Point( 7, 8, 15 ) ).dot( p - Z3i::Point( 7, 8, 15 ) );
+          weights.setValue( p, d > 0 ? d : 0 );
+        }
+
+      typedef ReverseDistanceTransformation<Weights, L2PowerMetric> RDT;
+      typedef ReverseDistanceTransformation<Weights, L2PowerMetric, LinearImage> RDTCompact;
+      RDT rdt( domain, weights, l2power );
+      RDTCompact rdtCompact( domain, weights, l2power );
+      unsigned int nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( rdt( p ) == rdtCompact( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+
+      typedef PowerMap<Weights, L2PowerMetric> Power;
+      typedef PowerMap<Weights, L2PowerMetric, LinearImage> PowerCompact;
+      Power power( domain, weights, l2power );
+      PowerCompact powerCompact( domain, weights, l2power );
+      auto rdma = ReducedMedialAxis<Power>::getReducedMedialAxisFromPowerMap( power );
+      auto rdmaCompact = ReducedMedialAxis<PowerCompact>::getReducedMedialAxisFromPowerMap( powerCompact );
+      nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( rdma( p ) == rdmaCompact( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
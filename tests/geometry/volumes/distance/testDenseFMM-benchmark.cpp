@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseFMM-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Throughput (accepted points per second) of FMM and DenseFMM on a
+ * 3D domain.
+ *
+ * Usage: testDenseFMM-benchmark [size] [nbSeeds] [maxSparseSize]
+ * (default: 256^3 domain, 16 random seeds, 96). DenseFMM is run with a
+ * vector-based image, with its default point functor (dense look-ups
+ * in a bitset of accepted points) and a tree-based or a bitset set of
+ * accepted points. Up to maxSparseSize^3, FMM is also run with a
+ * map-based image (as in exampleFMM3D.cpp), a vector-based image and a
+ * tree-based or hash-based set, and DenseFMM with a point functor on
+ * the tree-based set (sparse look-ups).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include <unordered_set>
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/DenseFMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef functors::DomainPredicate<Z3i::Domain> Predicate;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/// Builds an empty set of accepted points for a distance image.
+template <typename TSet>
+struct SetFactory
+{
+  template <typename TImage>
+  static TSet * make( TImage & image ) { return new TSet( image.domain() ); }
+};
+template <typename TImage>
+struct SetFactory< DigitalSetFromMap<TImage> >
+{
+  static DigitalSetFromMap<TImage> * make( TImage & image )
+  { return new DigitalSetFromMap<TImage>( image ); }
+};
+
+/**
+ * Runs the FMM engine @a TEngine from the seeds and reports its
+ * throughput. The distance image is returned in @a result.
+ */
+template <typename TEngine, typename TImage, typename TSet>
+double run( const std::string & name, const Z3i::Domain & domain,
+            const std::vector<Z3i::Point> & seeds,
+            ImageContainerBySTLVector<Z3i::Domain, double> & result )
+{
+  TImage image( domain );
+  std::unique_ptr<TSet> setPtr( SetFactory<TSet>::make( image ) );
+  TSet & set = *setPtr;
+  Predicate dp( domain );
+  FMM<TImage, TSet, Predicate>::initFromPointsRange( seeds.begin(), seeds.end(), image, set, 0.0 );
+
+  Clock c;
+  c.startClock();
+  TEngine fmm( image, set, dp );
+  fmm.compute();
+  const double t = c.stopClock();
+  trace.info() << name << ": " << set.size() << " points in " << t << " ms ("
+               << set.size() / t * 1000.0 << " points/s)" << std::endl;
+
+  for ( auto const & p : domain )
+    result.setValue( p, image( p ) );
+  return t;
+}
+
+/**
+ * Compares the throughput of the FMM engines on a @a size^3 domain
+ * from @a nbSeeds random seeds. The engines with sparse look-ups in
+ * the set of accepted points (FMM, and DenseFMM with a point functor
+ * on this set) are only run up to @a maxSparseSize^3.
+ */
+bool runBenchmark( int size, unsigned int nbSeeds, int maxSparseSize )
+{
+  typedef ImageContainerBySTLMap<Z3i::Domain, double> MapImage;
+  typedef DigitalSetFromMap<MapImage> MapSet;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> VectorImage;
+  typedef DigitalSetBySTLSet<Z3i::Domain> VectorSet;
+  typedef DigitalSetByAssociativeContainer<Z3i::Domain, std::unordered_set<Z3i::Point> > HashSet;
+  typedef DigitalSetByBitset<Z3i::Domain> BitsetSet;
+  typedef L2FirstOrderLocalDistance<VectorImage, VectorSet> SparseDistance;
+  typedef L2FirstOrderLocalDistance<VectorImage, HashSet> HashDistance;
+
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  std::vector<Z3i::Point> seeds;
+  srand( 0 );
+  for ( unsigned int i = 0; i < nbSeeds; ++i )
+    seeds.push_back( Z3i::Point( rand() % size, rand() % size, rand() % size ) );
+
+  // Dense engines: their results are the reference.
+  VectorImage ref( domain ), r( domain );
+  const double tDense = run< DenseFMM<VectorImage, VectorSet, Predicate>, VectorImage, VectorSet >
+    ( "DenseFMM (vector image, STL set, dense look-ups)", domain, seeds, ref );
+  const double tBitset = run< DenseFMM<VectorImage, BitsetSet, Predicate>, VectorImage, BitsetSet >
+    ( "DenseFMM (vector image, bitset set)", domain, seeds, r );
+  bool res = std::equal( r.begin(), r.end(), ref.begin() );
+  if ( size > maxSparseSize )
+    {
+      trace.info() << "Sparse look-ups skipped above " << maxSparseSize << "^3" << std::endl;
+      return res;
+    }
+
+  const double tMap = run< FMM<MapImage, MapSet, Predicate>, MapImage, MapSet >
+    ( "FMM (map image)", domain, seeds, r );
+  res = res && std::equal( r.begin(), r.end(), ref.begin() );
+  const double tVector = run< FMM<VectorImage, VectorSet, Predicate>, VectorImage, VectorSet >
+    ( "FMM (vector image)", domain, seeds, r );
+  res = res && std::equal( r.begin(), r.end(), ref.begin() );
+  const double tHash = run< FMM<VectorImage, HashSet, Predicate, HashDistance>, VectorImage, HashSet >
+    ( "FMM (vector image, hash set)", domain, seeds, r );
+  res = res && std::equal( r.begin(), r.end(), ref.begin() );
+  const double tSparse = run< DenseFMM<VectorImage, VectorSet, Predicate, SparseDistance>, VectorImage, VectorSet >
+    ( "DenseFMM (vector image, STL set, sparse look-ups)", domain, seeds, r );
+  res = res && std::equal( r.begin(), r.end(), ref.begin() );
+  trace.info() << "Speedup of DenseFMM: " << tMap / tDense << " (FMM map image), "
+               << tVector / tDense << " (FMM vector image), "
+               << tHash / tDense << " (FMM hash set), "
+               << tSparse / tDense << " (sparse look-ups), "
+               << tMap / tBitset << " (FMM map image vs bitset set)" << std::endl;
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking DenseFMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 256;
+  const unsigned int nbSeeds = argc > 2 ? (unsigned int) atoi( argv[ 2 ] ) : 16;
+  const int maxSparseSize = argc > 3 ? atoi( argv[ 3 ] ) : 96;
+
+  bool res = runBenchmark( size, nbSeeds, maxSparseSize );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseFMM.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DenseFMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/DenseFMM.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseFMM.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs FMM and DenseFMM from the same accepted points and checks
+ * that both accept the same points with the same values.
+ */
+template <typename TImage, typename TSet, typename TPredicate, typename TFunctor>
+bool sameAsFMM( const TImage & initImage, const TSet & initSet, const TPredicate & pred,
+                typename FMM<TImage, TSet, TPredicate, TFunctor>::Value maxValue,
+                DGtal::uint64_t maxArea )
+{
+  TImage image1( initImage ), image2( initImage );
+  TSet set1( initSet ), set2( initSet );
+  TFunctor f1( image1, set1 ), f2( image2, set2 );
+  FMM<TImage, TSet, TPredicate, TFunctor> fmm( image1, set1, pred, maxArea, maxValue, f1 );
+  DenseFMM<TImage, TSet, TPredicate, TFunctor> dense( image2, set2, pred, maxArea, maxValue, f2 );
+  fmm.compute();
+  dense.compute();
+  trace.info() << fmm << std::endl << dense << std::endl;
+  if ( ! dense.isValid() || set1.size() != set2.size()
+       || fmm.min() != dense.min() || fmm.max() != dense.max() )
+    return false;
+  for ( auto const & p : set1 )
+    if ( set2.find( p ) == set2.end() || image1( p ) != image2( p ) )
+      return false;
+  return true;
+}
+
+TEST_CASE( "Testing DenseFMM" )
+{
+  typedef functors::DomainPredicate<Z3i::Domain> Predicate3;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> Image3;
+  typedef DigitalSetBySTLSet<Z3i::Domain> Set3;
+
+  Z3i::Domain domain( Z3i::Point( -6, 0, 3 ), Z3i::Point( 17, 20, 25 ) );
+  Predicate3 dp( domain );
+  Image3 image( domain );
+  Set3 set( domain );
+  srand( 0 );
+  std::vector<Z3i::Point> seeds;
+  for ( unsigned int i = 0; i < 10; ++i )
+    seeds.push_back( domain.lowerBound() + Z3i::Point( rand() % 24, rand() % 21, rand() % 23 ) );
+  FMM<Image3, Set3, Predicate3>::initFromPointsRange( seeds.begin(), seeds.end(), image, set, 0.0 );
+
+  SECTION("L2 first order distance, whole domain")
+    {
+      typedef L2FirstOrderLocalDistance<Image3, Set3> Distance;
+      const bool ok = sameAsFMM<Image3, Set3, Predicate3, Distance>
+        ( image, set, dp, std::numeric_limits<double>::max(),
+          std::numeric_limits<DGtal::uint64_t>::max() );
+      REQUIRE( ok );
+
+      // Default point functor, reading the dense set of accepted points.
+      Image3 image2( image ), image3( image );
+      Set3 set2( set ), set3( set );
+      FMM<Image3, Set3, Predicate3> fmm( image3, set3, dp );
+      fmm.compute();
+      DenseFMM<Image3, Set3, Predicate3> dense( image2, set2, dp );
+      dense.compute();
+      REQUIRE( set2.size() == domain.size() );
+      REQUIRE( dense.nbCandidates() == 0 );
+      REQUIRE( std::equal( image2.begin(), image2.end(), image3.begin() ) );
+    }
+
+  SECTION("Dense set of accepted points within a narrow band")
+    {
+      typedef DigitalSetByBitset<Z3i::Domain> DenseSet3;
+      typedef L1LocalDistance<Image3, DenseSet3> DenseDistance1;
+      typedef L1LocalDistance<Image3, Set3> Distance1;
+      Image3 image2( image ), image3( image );
+      Set3 set3( set );
+      DenseSet3 set2( domain );
+      set2.insert( set.begin(), set.end() );
+      FMM<Image3, Set3, Predicate3, Distance1> fmm( image3, set3, dp, 1500, 1000.0 );
+      fmm.compute();
+      DenseFMM<Image3, DenseSet3, Predicate3, DenseDistance1> dense( image2, set2, dp, 1500, 1000.0 );
+      dense.compute();
+      REQUIRE( dense.isValid() );
+      REQUIRE( set2.size() == set3.size() );
+      unsigned int nbok = 0;
+      for ( auto const & p : set3 )
+        nbok += ( set2( p ) && image2( p ) == image3( p ) ) ? 1 : 0;
+      REQUIRE( nbok == set3.size() );
+    }
+
+  SECTION("L2 second order and L1 distances within a narrow band")
+    {
+      typedef L2SecondOrderLocalDistance<Image3, Set3> Distance2;
+      typedef L1LocalDistance<Image3, Set3> Distance1;
+      REQUIRE( sameAsFMM<Image3, Set3, Predicate3, Distance2>( image, set, dp, 3.5, 100000 ) );
+      REQUIRE( sameAsFMM<Image3, Set3, Predicate3, Distance1>( image, set, dp, 1000.0, 1500 ) );
+    }
+
+  SECTION("Signed distance from a ball boundary")
+    {
+      typedef ImageContainerBySTLVector<Z2i::Domain, double> Image2;
+      typedef DigitalSetBySTLSet<Z2i::Domain> Set2;
+      typedef functors::DomainPredicate<Z2i::Domain> Predicate2;
+      typedef L2FirstOrderLocalDistance<Image2, Set2> Distance;
+      Z2i::Domain domain2( Z2i::Point( -30, -30 ), Z2i::Point( 30, 30 ) );
+      Predicate2 dp2( domain2 );
+      Image2 image2( domain2 );
+      Set2 set2( domain2 );
+
+      // Pairs of inner/outer 4-adjacent points around a disk.
+      std::vector< std::pair<Z2i::Point, Z2i::Point> > pairs;
+      for ( auto const & p : domain2 )
+        if ( p.squaredNorm() <= 400 )
+          for ( Dimension k = 0; k < 2; ++k )
+            for ( int s = -1; s <= 1; s += 2 )
+              {
+                Z2i::Point q = p;
+                q[ k ] += s;
+                if ( q.squaredNorm() > 400 )
+                  pairs.push_back( std::make_pair( p, q ) );
+              }
+      FMM<Image2, Set2, Predicate2>::initFromIncidentPointsRange( pairs.begin(), pairs.end(),
+                                                                 image2, set2, 0.5 );
+      REQUIRE( sameAsFMM<Image2, Set2, Predicate2, Distance>( image2, set2, dp2, 10.0,
+                                                              std::numeric_limits<DGtal::uint64_t>::max() ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
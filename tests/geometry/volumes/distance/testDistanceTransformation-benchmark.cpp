@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDistanceTransformation-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the DistanceTransformation computation for the L1,
+ * L2 and Linf metrics: sequential line-by-line engine vs. the block
+ * and tiled engines run by thread pools (see VoronoiMapEngine).
+ *
+ * Usage: testDistanceTransformation-benchmark [size] [maxThreads]
+ * (default: 128^3 volume, thread counts up to the number of hardware
+ * threads). Cache misses of the engines can be compared by running
+ * this benchmark with "perf stat -e cache-misses,L1-dcache-load-misses".
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <thread>
+#include <string>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/images/IntervalForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef functors::IntervalForegroundPredicate<Image> Binarizer;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs the DT with metric @a aMetric on the binary volume @a image,
+ * first with the sequential line-by-line engine, then with the block
+ * and tiled engines on thread pools of increasing sizes (a pool of
+ * size 1 running an engine sequentially). At most two maps are
+ * stored at a time.
+ */
+template <typename Metric>
+bool runBenchmark( const std::string & name, const Image & image,
+                   const Metric & aMetric, unsigned int maxThreads )
+{
+  typedef DistanceTransformation<Z3i::Space, Binarizer, Metric> DT;
+  Binarizer b( image, 0, 255 );
+
+  trace.beginBlock( "Metric " + name );
+  Clock c;
+  c.startClock();
+  DT dtSeq( image.domain(), b, aMetric );
+  const double tSeq = c.stopClock();
+  trace.info() << "Line by line: " << tSeq << " ms" << std::endl;
+
+  bool ok = true;
+  for ( unsigned int nb = 1; nb <= maxThreads; nb *= 2 )
+    {
+      ThreadPool pool( nb );
+      double tBlocks = 0.0;
+      for ( VoronoiMapEngine engine : { VoronoiMapBlocks, VoronoiMapTiles } )
+        {
+          c.startClock();
+          DT dtPool( image.domain(), b, aMetric, &pool, engine );
+          const double t = c.stopClock();
+          if ( engine == VoronoiMapBlocks ) tBlocks = t;
+          trace.info() << ( engine == VoronoiMapBlocks ? "Blocks" : "Tiles" )
+                       << ", ThreadPool(" << nb << "): " << t << " ms"
+                       << " speedup=" << tSeq / t
+                       << " speedup vs blocks=" << tBlocks / t << std::endl;
+          ok = ok && std::equal( dtSeq.constRange().begin(), dtSeq.constRange().end(),
+                                 dtPool.constRange().begin() );
+        }
+    }
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * Runs the benchmarks on a random binary volume of size @a size^3.
+ */
+bool runBenchmarks( int size, unsigned int maxThreads )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( auto const & p : domain )
+    image.setValue( p, ( rand() % 1000 ) == 0 ? 0 : 1 );
+  trace.info() << "Volume: " << size << "^3, sites ~ 0.1%" << std::endl;
+
+  ExactPredicateLpSeparableMetric<Z3i::Space, 1> l1;
+  ExactPredicateLpSeparableMetric<Z3i::Space, 2> l2;
+  ExactPredicateLpSeparableMetric<Z3i::Space, 0> linf;
+  return runBenchmark( "L1", image, l1, maxThreads )
+    && runBenchmark( "L2", image, l2, maxThreads )
+    && runBenchmark( "Linf", image, linf, maxThreads );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking DistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 128;
+  const unsigned int maxThreads = argc > 2 ? (unsigned int) atoi( argv[ 2 ] )
+    : std::max( 1u, std::thread::hardware_concurrency() );
+
+  bool res = runBenchmarks( size, maxThreads );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,152 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDynamicDistanceTransformation-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the incremental update of a DynamicDistanceTransformation
+ * after local edits of a binary volume vs. the full recomputation of
+ * the DistanceTransformation.
+ *
+ * Usage: testDynamicDistanceTransformation-benchmark [size] [nbEdits]
+ * (default: 128^3 volume, 4000 edited voxels per batch). The volume is
+ * a ball (the foreground), each batch adds or removes voxels in a
+ * small box on its boundary, as in a segmentation editing loop.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/DynamicDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef functors::SimpleThresholdForegroundPredicate<Image> Binarizer;
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs batches of @a nbEdits voxel edits on a ball of a @a size^3
+ * volume, comparing the update of the dynamic DT with the full DT.
+ */
+bool runBenchmark( int size, unsigned int nbEdits )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  const Z3i::Point center = Z3i::Point::diagonal( size / 2 );
+  const double radius = size / 3.0;
+  Image image( domain );
+  for ( auto const & p : domain )
+    image.setValue( p, ( p - center ).norm() <= radius ? 1 : 0 );
+  Binarizer b( image, 0 );
+  L2Metric l2;
+
+  Clock c;
+  c.startClock();
+  DynamicDistanceTransformation<Z3i::Space, L2Metric> dyn( domain, b, l2 );
+  trace.info() << "Dynamic DT construction: " << c.stopClock() << " ms" << std::endl;
+
+  bool ok = true;
+  double tFull = 0.0, tDyn = 0.0;
+  const unsigned int nbBatches = 5;
+  const int box = std::max( 2, (int) std::ceil( std::pow( 2.0 * nbEdits, 1.0 / 3.0 ) ) );
+  srand( 0 );
+  for ( unsigned int batch = 0; batch < nbBatches; ++batch )
+    {
+      // Edits in a box centered on a boundary point of the ball.
+      const Z3i::Point corner = center + Z3i::Point( (int) radius - box / 2,
+                                                     rand() % box - box / 2,
+                                                     rand() % box - box / 2 );
+      std::vector<Z3i::Point> newSites, removedSites;
+      for ( unsigned int i = 0; i < nbEdits; ++i )
+        {
+          const Z3i::Point p = corner + Z3i::Point( rand() % box, rand() % box, rand() % box );
+          if ( ! domain.isInside( p ) )
+            continue;
+          // Each batch either grows or shrinks the foreground.
+          if ( batch % 2 == 0 && image( p ) == 0 )
+            {
+              image.setValue( p, 1 );
+              removedSites.push_back( p );
+            }
+          else if ( batch % 2 == 1 && image( p ) == 1 )
+            {
+              image.setValue( p, 0 );
+              newSites.push_back( p );
+            }
+        }
+
+      c.startClock();
+      const auto nbChanged = dyn.update( newSites, removedSites );
+      const double t = c.stopClock();
+      tDyn += t;
+
+      c.startClock();
+      DistanceTransformation<Z3i::Space, Binarizer, L2Metric> dt( domain, b, l2 );
+      const double tf = c.stopClock();
+      tFull += tf;
+
+      trace.info() << "Batch " << batch << ": " << newSites.size() + removedSites.size()
+                   << " edits, " << nbChanged << " changed sites, update " << t
+                   << " ms, full " << tf << " ms" << std::endl;
+      ok = ok && std::equal( dt.constRange().begin(), dt.constRange().end(),
+                             dyn.constRange().begin() );
+    }
+  trace.info() << "Average update: " << tDyn / nbBatches << " ms, average full DT: "
+               << tFull / nbBatches << " ms, speedup=" << tFull / tDyn << std::endl;
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking DynamicDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 128;
+  const unsigned int nbEdits = argc > 2 ? (unsigned int) atoi( argv[ 2 ] ) : 4000;
+
+  bool res = runBenchmark( size, nbEdits );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,158 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDynamicDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DynamicDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/DynamicDistanceTransformation.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DynamicDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Applies random batches of insertions and deletions of sites
+ * in a small box and compares the result with a full
+ * DistanceTransformation after each batch.
+ */
+template <typename Metric>
+unsigned int checkRandomEdits( const Z3i::Domain & domain, const Metric & aMetric,
+                               std::array<bool, 3> const & periodicity,
+                               ThreadPool * pool )
+{
+  typedef DynamicDistanceTransformation<Z3i::Space, Metric> DynDT;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< DynDT > ));
+
+  // Foreground (non-site) points.
+  Z3i::DigitalSet set( domain );
+  srand( 0 );
+  for ( auto const & p : domain )
+    if ( rand() % 100 != 0 )
+      set.insertNew( p );
+
+  DynDT dyn( domain, set, aMetric, periodicity, pool );
+  unsigned int nbErrors = 0;
+  for ( unsigned int batch = 0; batch < 6; ++batch )
+    {
+      const Z3i::Point corner( domain.lowerBound()[ 0 ] + rand() % 12,
+                               domain.lowerBound()[ 1 ] + rand() % 12,
+                               domain.lowerBound()[ 2 ] + rand() % 12 );
+      std::vector<Z3i::Point> newSites, removedSites;
+      Z3i::DigitalSet touched( domain );
+      for ( unsigned int i = 0; i < 40; ++i )
+        {
+          const Z3i::Point p = corner + Z3i::Point( rand() % 8, rand() % 8, rand() % 8 );
+          if ( touched( p ) )
+            continue;
+          touched.insertNew( p );
+          if ( set( p ) )
+            {
+              set.erase( p );
+              newSites.push_back( p );
+            }
+          else
+            {
+              set.insertNew( p );
+              removedSites.push_back( p );
+            }
+        }
+      // Removing every site of the box on the last batch.
+      if ( batch == 5 )
+        for ( auto const & p : Z3i::Domain( corner, corner + Z3i::Point::diagonal( 7 ) ) )
+          if ( ! set( p ) )
+            {
+              set.insertNew( p );
+              removedSites.push_back( p );
+            }
+
+      dyn.update( newSites, removedSites, pool );
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, Metric> dt( domain, set, aMetric, periodicity );
+      for ( auto const & p : domain )
+        if ( dt( p ) != dyn( p ) || dyn.isSite( p ) == set( p ) )
+          ++nbErrors;
+    }
+  return nbErrors;
+}
+
+TEST_CASE( "Testing DynamicDistanceTransformation" )
+{
+  Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 14, 19, 21 ) );
+  const std::array<bool, 3> noPeriodicity = {{ false, false, false }};
+  ExactPredicateLpSeparableMetric<Z3i::Space, 2> l2;
+  ExactPredicateLpSeparableMetric<Z3i::Space, 1> l1;
+
+  SECTION("Insertion and deletion of sites")
+    {
+      Z3i::DigitalSet set( domain );
+      for ( auto const & p : domain )
+        if ( p != Z3i::Point( 0, 0, 2 ) )
+          set.insertNew( p );
+      DynamicDistanceTransformation<Z3i::Space, ExactPredicateLpSeparableMetric<Z3i::Space, 2> > dyn( domain, set, l2 );
+      REQUIRE( dyn.isValid() );
+      REQUIRE( dyn( Z3i::Point( 3, 4, 2 ) ) == 5 );
+
+      std::vector<Z3i::Point> sites = { Z3i::Point( 3, 4, 3 ) };
+      REQUIRE( dyn.insertSites( sites ) > 0 );
+      REQUIRE( dyn( Z3i::Point( 3, 4, 2 ) ) == 1 );
+      REQUIRE( dyn.insertSites( sites ) == 0 );
+      REQUIRE( dyn.removeSites( sites ) > 0 );
+      REQUIRE( dyn( Z3i::Point( 3, 4, 2 ) ) == 5 );
+    }
+
+  SECTION("Random edits, l2 metric")
+    {
+      REQUIRE( checkRandomEdits( domain, l2, noPeriodicity, nullptr ) == 0 );
+    }
+
+  SECTION("Random edits, l1 metric and thread pool")
+    {
+      ThreadPool pool( 3 );
+      REQUIRE( checkRandomEdits( domain, l1, noPeriodicity, &pool ) == 0 );
+    }
+
+  SECTION("Random edits, periodic l2 metric")
+    {
+      const std::array<bool, 3> periodicity = {{ true, false, true }};
+      REQUIRE( checkRandomEdits( domain, l2, periodicity, nullptr ) == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
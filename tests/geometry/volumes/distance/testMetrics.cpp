@@ -37,6 +37,7 @@
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -476,6 +477,43 @@ bool testConcepts()
   return true;
 }
 
+bool testPartialHiddenByL2()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing l_2 hiddenByPartial ..." );
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 3> L3;
+  BOOST_STATIC_ASSERT(( detail::HasPartialHiddenBy<L2>::value ));
+  BOOST_STATIC_ASSERT(( ! detail::HasPartialHiddenBy<L3>::value ));
+  L2 metric;
+
+  const Z3i::Point starting( 0, 7, -3 ), endpoint( 0, 7, 60 );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      // Sites sorted along the line (dim 2).
+      Z3i::Point sites[ 3 ];
+      int z = rand() % 10;
+      for ( unsigned int k = 0; k < 3; ++k, z += 1 + rand() % 20 )
+        sites[ k ] = Z3i::Point( rand() % 40 - 20, rand() % 40 - 20, z );
+      L2::RawValue partials[ 3 ];
+      metric.partialRawDistances( sites, 3, starting, 2, partials );
+      const bool hidden = metric.hiddenBy( sites[ 0 ], sites[ 1 ], sites[ 2 ], starting, endpoint, 2 );
+      const bool hiddenPartial = metric.hiddenByPartial( sites[ 0 ][ 2 ], partials[ 0 ],
+                                                         sites[ 1 ][ 2 ], partials[ 1 ],
+                                                         sites[ 2 ][ 2 ], partials[ 2 ] );
+      nbok += ( hidden == hiddenPartial
+                && partials[ 0 ] == metric.rawDistance( sites[ 0 ], Z3i::Point( 0, 7, sites[ 0 ][ 2 ] ) ) ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "hiddenBy == hiddenByPartial" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -494,6 +532,7 @@ int main( int argc, char** argv )
     && testBinarySearch()
     && testSpecialCasesL2()
     && testSpecialCasesLp()
+    && testPartialHiddenByL2()
     && testConcepts();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
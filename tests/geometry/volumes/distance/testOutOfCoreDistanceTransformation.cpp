@@ -0,0 +1,123 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class OutOfCoreDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCache.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing OutOfCoreDistanceTransformation" )
+{
+  // Backing store of the site image, accessed through a tile cache.
+  typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> Store;
+  typedef ImageFactoryFromImage<Store> Factory;
+  typedef Factory::OutputImage Tile;
+  typedef ImageCacheReadPolicyFIFO<Tile, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWB<Tile, Factory> WritePolicy;
+  typedef TiledImage<Store, Factory, ReadPolicy, WritePolicy> SiteImage;
+
+  Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 26, 27, 33 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 0 );
+  for ( auto const & p : domain )
+    if ( rand() % 300 != 0 )
+      set.insertNew( p );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  L2Metric l2;
+  typedef OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric, SiteImage> OOCDT;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< OOCDT > ));
+
+  Store store( domain );
+  Factory factory( store );
+  ReadPolicy readPolicy( factory, 8 );
+  WritePolicy writePolicy( factory );
+  SiteImage sites( factory, readPolicy, writePolicy, 4 );
+
+  // 32x28 hyperplanes of 12-byte vectors: 4 planes per slab.
+  const std::size_t maxSlabBytes = 4 * 32 * 28 * sizeof( Z3i::Vector );
+
+  SECTION("Comparison with DistanceTransformation")
+    {
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain, set, l2 );
+      OOCDT ooc( domain, set, l2, sites, maxSlabBytes );
+      trace.info() << ooc << std::endl;
+      REQUIRE( ooc.isValid() );
+      REQUIRE( ooc.slabThicknesses()[ 0 ] == 4 );
+      unsigned int nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( dt.getVoronoiVector( p ) == ooc.getVoronoiVector( p )
+                  && dt( p ) == ooc( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+
+  SECTION("Periodic computation with a thread pool")
+    {
+      const std::array<bool, 3> periodicity = {{ true, false, true }};
+      ThreadPool pool( 3 );
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain, set, l2, periodicity );
+      OOCDT ooc( domain, set, l2, periodicity, sites, maxSlabBytes, &pool );
+      unsigned int nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( dt.getVoronoiVector( p ) == ooc.getVoronoiVector( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+
+  SECTION("One hyperplane per slab")
+    {
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain, set, l2 );
+      OOCDT ooc( domain, set, l2, sites, 1 );
+      REQUIRE( ooc.slabThicknesses()[ 0 ] == 1 );
+      REQUIRE( ooc.slabThicknesses()[ 1 ] == 1 );
+      unsigned int nbok = 0;
+      for ( auto const & p : domain )
+        nbok += ( dt( p ) == ooc( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
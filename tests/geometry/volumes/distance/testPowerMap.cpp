@@ -30,9 +30,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <array>
+#include <algorithm>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
@@ -325,6 +327,14 @@ bool testPowerMapFromSites( const Set &aSet, std::array<bool, Set::Space::dimens
   nb++;
   trace.endBlock();
 
+  trace.beginBlock(" Power Map computation l_2 with a thread pool");
+  ThreadPool pool( 3 );
+  Power2 power2Pool( aSet.domain(), image, l2, periodicity, &pool );
+  nbok += std::equal( power2.constRange().begin(), power2.constRange().end(),
+                      power2Pool.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
   trace.beginBlock(" Power Map computation l_3");
   typedef ExactPredicateLpPowerSeparableMetric<typename Set::Space, 3> L3PowerMetric;
   typedef PowerMap< Image, L3PowerMetric > Power3;
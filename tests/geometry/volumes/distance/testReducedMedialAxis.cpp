@@ -33,6 +33,7 @@
 
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
 #include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
@@ -131,6 +132,17 @@ bool testReducedMedialAxis( std::array<bool, 2> const& aPeriodicity = {{ false,
     }
   trace.info()<<std::endl;
 
+  //Power map and medial axis extraction with a thread pool
+  ThreadPool pool( 3 );
+  PowerMap<Image, Z2i::L2PowerMetric> powerPool(&domainLarge, &image, &l2power, aPeriodicity, &pool );
+  ReducedMedialAxis<PowerMap<Image, Z2i::L2PowerMetric> >::Type rdmaPool = ReducedMedialAxis< PowerMap<Image, Z2i::L2PowerMetric> >::getReducedMedialAxisFromPowerMap(powerPool, &pool);
+  bool poolOk = true;
+  for ( auto const & pt : domainLarge )
+    poolOk = poolOk && ( power(pt) == powerPool(pt) ) && ( rdma(pt) == rdmaPool(pt) );
+  nbok += poolOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "thread pool == sequential" << std::endl;
 
   ++nbok;
   nb++;
@@ -0,0 +1,167 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testReverseDT-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Throughput benchmark of the ReverseDistanceTransformation and of the
+ * ReducedMedialAxis extraction (sequential vs. thread pools), and of
+ * the hiddenByPower predicate of the l2 power metric.
+ *
+ * Usage: testReverseDT-benchmark [size] [nbShapes] [maxThreads]
+ * (default: 10 shapes of 64^3, thread counts up to the number of
+ * hardware threads). Each shape is the union of random balls given
+ * by their squared radii.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> Weights;
+typedef ExactPredicateLpPowerSeparableMetric<Z3i::Space, 2> L2PowerMetric;
+typedef ReverseDistanceTransformation<Weights, L2PowerMetric> RDT;
+typedef PowerMap<Weights, L2PowerMetric> Power;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Throughput of the hiddenByPower predicate on random triples.
+ */
+bool benchmarkHiddenBy()
+{
+  const std::size_t nb = 1 << 20;
+  std::vector<Z3i::Point> points( 3 * nb );
+  std::vector<DGtal::int64_t> weights( 3 * nb );
+  srand( 0 );
+  for ( std::size_t i = 0; i < 3 * nb; ++i )
+    {
+      points[ i ] = Z3i::Point( rand() % 512, rand() % 512, rand() % 512 );
+      weights[ i ] = rand() % 1000;
+    }
+  const Z3i::Point start( 0, 17, 33 );
+  L2PowerMetric l2;
+
+  Clock c;
+  std::size_t nbHidden = 0;
+  c.startClock();
+  for ( unsigned int r = 0; r < 10; ++r )
+    for ( std::size_t i = 0; i < nb; ++i )
+      nbHidden += l2.hiddenByPower( points[ 3*i ], weights[ 3*i ], points[ 3*i+1 ], weights[ 3*i+1 ],
+                                    points[ 3*i+2 ], weights[ 3*i+2 ], start, start, r % 3 ) ? 1 : 0;
+  const double t = c.stopClock();
+  trace.info() << "hiddenByPower: " << 10.0 * nb / t / 1000.0 << " M/s ("
+               << nbHidden << " hidden)" << std::endl;
+  return true;
+}
+
+/**
+ * Reconstruction and medial axis throughput on @a nbShapes shapes of
+ * size @a size^3.
+ */
+bool benchmarkReconstruction( int size, unsigned int nbShapes, unsigned int maxThreads )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  std::vector<Weights> shapes;
+  srand( 0 );
+  for ( unsigned int s = 0; s < nbShapes; ++s )
+    {
+      Weights weights( domain );
+      for ( unsigned int i = 0; i < 200; ++i )
+        weights.setValue( Z3i::Point( rand() % size, rand() % size, rand() % size ),
+                          1 + rand() % ( size * size / 16 ) );
+      shapes.push_back( weights );
+    }
+  L2PowerMetric l2;
+
+  Clock c;
+  c.startClock();
+  std::vector<std::size_t> volumes;
+  for ( auto const & w : shapes )
+    {
+      RDT rdt( domain, w, l2 );
+      volumes.push_back( std::count_if( rdt.constRange().begin(), rdt.constRange().end(),
+                                        [] ( DGtal::int64_t d ) { return d < 0; } ) );
+      Power power( domain, w, l2 );
+      auto rdma = ReducedMedialAxis<Power>::getReducedMedialAxisFromPowerMap( power );
+    }
+  const double tSeq = c.stopClock();
+  trace.info() << "Sequential: " << 1000.0 * nbShapes / tSeq << " shapes/s" << std::endl;
+
+  bool ok = true;
+  for ( unsigned int nb = 1; nb <= maxThreads; nb *= 2 )
+    {
+      ThreadPool pool( nb );
+      c.startClock();
+      for ( std::size_t s = 0; s < shapes.size(); ++s )
+        {
+          RDT rdt( domain, shapes[ s ], l2, &pool );
+          ok = ok && volumes[ s ] == (std::size_t) std::count_if( rdt.constRange().begin(), rdt.constRange().end(),
+                                                                 [] ( DGtal::int64_t d ) { return d < 0; } );
+          Power power( domain, shapes[ s ], l2, &pool );
+          auto rdma = ReducedMedialAxis<Power>::getReducedMedialAxisFromPowerMap( power, &pool );
+        }
+      const double t = c.stopClock();
+      trace.info() << "ThreadPool(" << nb << "): " << 1000.0 * nbShapes / t << " shapes/s"
+                   << " speedup=" << tSeq / t << std::endl;
+    }
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking ReverseDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 64;
+  const unsigned int nbShapes = argc > 2 ? (unsigned int) atoi( argv[ 2 ] ) : 10;
+  const unsigned int maxThreads = argc > 3 ? (unsigned int) atoi( argv[ 3 ] )
+    : std::max( 1u, std::thread::hardware_concurrency() );
+
+  bool res = benchmarkHiddenBy() && benchmarkReconstruction( size, nbShapes, maxThreads );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,213 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSeparableMetrics-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Micro-benchmarks of the hiddenBy and closest predicates of the
+ * separable metrics, of the batched l_2 predicate (partialRawDistances
+ * and hiddenByPartial), and of the VoronoiMap with and without the
+ * batched l_2 predicate.
+ *
+ * Usage: testSeparableMetrics-benchmark [nbCalls] [size]
+ * (default: 10^7 predicate calls, 128^3 VoronoiMap domain).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+
+/**
+ * l_2 metric without the batched services, so that VoronoiMap uses
+ * its generic hiddenBy path.
+ */
+struct PlainL2Metric
+{
+  typedef L2Metric::Space Space;
+  typedef L2Metric::Point Point;
+  typedef L2Metric::Vector Vector;
+  typedef L2Metric::Value Value;
+  typedef L2Metric::RawValue RawValue;
+
+  Value operator()( const Point & p, const Point & q ) const
+  { return myMetric( p, q ); }
+  RawValue rawDistance( const Point & p, const Point & q ) const
+  { return myMetric.rawDistance( p, q ); }
+  Closest closest( const Point & o, const Point & p, const Point & q ) const
+  { return myMetric.closest( o, p, q ); }
+  bool hiddenBy( const Point & u, const Point & v, const Point & w,
+                 const Point & s, const Point & e,
+                 const Point::UnsignedComponent dim ) const
+  { return myMetric.hiddenBy( u, v, w, s, e, dim ); }
+
+  L2Metric myMetric;
+};
+
+/// Random triples of sites sorted along dimension 2.
+std::vector<Z3i::Point> randomTriples( unsigned int nb )
+{
+  std::vector<Z3i::Point> sites( 3 * nb );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      int z = rand() % 64;
+      for ( unsigned int k = 0; k < 3; ++k, z += 1 + rand() % 64 )
+        sites[ 3 * i + k ] = Z3i::Point( rand() % 256, rand() % 256, z );
+    }
+  return sites;
+}
+
+/// Number of closest predicates returning ClosestFIRST.
+unsigned int nbClosestFirst = 0;
+
+/**
+ * Throughput of the hiddenBy and closest predicates of @a metric.
+ * @return the number of hiddenBy predicates returning true.
+ */
+template <typename TMetric>
+unsigned int benchPredicates( const std::string & name, const TMetric & metric,
+                              const std::vector<Z3i::Point> & sites )
+{
+  const Z3i::Point start( 128, 128, 0 ), end( 128, 128, 255 );
+  const std::size_t nb = sites.size() / 3;
+  unsigned int count = 0;
+  Clock c;
+  c.startClock();
+  for ( std::size_t i = 0; i < nb; ++i )
+    count += metric.hiddenBy( sites[ 3*i ], sites[ 3*i+1 ], sites[ 3*i+2 ], start, end, 2 ) ? 1 : 0;
+  const double t1 = c.stopClock();
+  c.startClock();
+  for ( std::size_t i = 0; i < nb; ++i )
+    nbClosestFirst += metric.closest( sites[ 3*i ], sites[ 3*i+1 ], sites[ 3*i+2 ] ) == ClosestFIRST ? 1 : 0;
+  const double t2 = c.stopClock();
+  trace.info() << name << ": hiddenBy " << nb / t1 / 1000.0 << " M/s, closest "
+               << nb / t2 / 1000.0 << " M/s" << std::endl;
+  return count;
+}
+
+/**
+ * Throughput of the batched l_2 predicate, partial distances included.
+ * @return the number of hiddenByPartial predicates returning true.
+ */
+unsigned int benchPartial( const std::vector<Z3i::Point> & sites )
+{
+  L2Metric metric;
+  const Z3i::Point start( 128, 128, 0 );
+  const std::size_t nb = sites.size() / 3;
+  // Partial distances are computed by chunks, as for image lines.
+  const std::size_t chunk = 256;
+  std::vector<L2Metric::RawValue> partials( 3 * chunk );
+  unsigned int count = 0;
+  Clock c;
+  c.startClock();
+  for ( std::size_t first = 0; first < nb; first += chunk )
+    {
+      const std::size_t last = std::min( nb, first + chunk );
+      metric.partialRawDistances( sites.data() + 3 * first, 3 * ( last - first ),
+                                  start, 2, partials.data() );
+      for ( std::size_t i = first; i < last; ++i )
+        {
+          const L2Metric::RawValue * n = partials.data() + 3 * ( i - first );
+          count += metric.hiddenByPartial( sites[ 3*i ][ 2 ], n[ 0 ],
+                                           sites[ 3*i+1 ][ 2 ], n[ 1 ],
+                                           sites[ 3*i+2 ][ 2 ], n[ 2 ] ) ? 1 : 0;
+        }
+    }
+  const double t = c.stopClock();
+  trace.info() << "l_2 (batched): hiddenByPartial " << nb / t / 1000.0 << " M/s" << std::endl;
+  return count;
+}
+
+/**
+ * VoronoiMap of a random volume with the l_2 metric, with and
+ * without the batched predicate.
+ */
+bool benchVoronoiMap( int size )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef functors::SimpleThresholdForegroundPredicate<Image> Binarizer;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image image( domain );
+  for ( auto const & p : domain )
+    image.setValue( p, rand() % 1000 != 0 ? 1 : 0 );
+  Binarizer b( image, 0 );
+
+  L2Metric l2;
+  PlainL2Metric plain;
+  Clock c;
+  c.startClock();
+  VoronoiMap<Z3i::Space, Binarizer, PlainL2Metric> voro1( domain, b, plain );
+  const double t1 = c.stopClock();
+  c.startClock();
+  VoronoiMap<Z3i::Space, Binarizer, L2Metric> voro2( domain, b, l2 );
+  const double t2 = c.stopClock();
+  trace.info() << "VoronoiMap " << size << "^3: hiddenBy " << t1 << " ms, batched "
+               << t2 << " ms, speedup=" << t1 / t2 << std::endl;
+  return std::equal( voro1.constRange().begin(), voro1.constRange().end(),
+                     voro2.constRange().begin() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking separable metrics" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int nbCalls = argc > 1 ? (unsigned int) atoi( argv[ 1 ] ) : 10000000;
+  const int size = argc > 2 ? atoi( argv[ 2 ] ) : 128;
+
+  srand( 0 );
+  const std::vector<Z3i::Point> sites = randomTriples( nbCalls );
+  benchPredicates( "l_1", ExactPredicateLpSeparableMetric<Z3i::Space, 1>(), sites );
+  const unsigned int count = benchPredicates( "l_2", L2Metric(), sites );
+  benchPredicates( "l_3", ExactPredicateLpSeparableMetric<Z3i::Space, 3>(), sites );
+  benchPredicates( "l_2 (inexact)", InexactPredicateLpSeparableMetric<Z3i::Space>( 2.0 ), sites );
+  const unsigned int countPartial = benchPartial( sites );
+  trace.info() << "(" << nbClosestFirst << " closest first)" << std::endl;
+
+  bool res = ( count == countPartial ) && benchVoronoiMap( size );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #include <algorithm>
 
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
@@ -514,6 +515,29 @@ bool testVoronoiMapFromSites( const Set &aSet, std::array<bool, Set::Space::dime
   nb++;
   trace.endBlock();
 
+  trace.beginBlock(" Voronoi computation l_2 with a thread pool");
+  ThreadPool pool( 3 );
+  Voro2 voroPool(aSet.domain(), mySet, l2, periodicity, &pool);
+  trace.endBlock();
+
+  trace.beginBlock("Validating the Voronoi Map l_2 (thread pool)");
+  nbok += checkVoronoi(aSet, voroPool) ? 1 : 0;
+  nb++;
+  nbok += std::equal( voro.constRange().begin(), voro.constRange().end(),
+                      voroPool.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
+  trace.beginBlock(" Voronoi computation l_2 with a thread pool and the block engine");
+  Voro2 voroBlocks(aSet.domain(), mySet, l2, periodicity, &pool, VoronoiMapBlocks);
+  trace.endBlock();
+
+  trace.beginBlock("Validating the Voronoi Map l_2 (block engine)");
+  nbok += std::equal( voro.constRange().begin(), voro.constRange().end(),
+                      voroBlocks.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
   trace.beginBlock(" DT computation");
   typedef DistanceTransformation<typename Set::Space, Set, L2Metric> DT;
   DT dt(aSet.domain(), mySet, l2, periodicity);
@@ -31,6 +31,8 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -82,5 +84,121 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > label surfaces", "[shortcuts][labels]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+  typedef SH3::Point                                Point;
+
+  auto params = SH3::defaultParameters();
+  SH3::Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  CountedPtr< SH3::GrayScaleImage > labels( new SH3::GrayScaleImage( domain ) );
+  for ( auto p : domain )
+    {
+      unsigned char l = 0;
+      if ( ( p - Point( -3, 0, 0 ) ).squaredNorm() <= 25 ) l = 1;
+      if ( ( p - Point(  6, 0, 0 ) ).squaredNorm() <= 4 )  l = 2;
+      labels->setValue( p, l );
+    }
+  auto K        = SH3::getKSpace( labels );
+  auto surfaces = SH3::makeLabelIdxDigitalSurfaces( labels, K, params );
+  GIVEN( "A label image with two disjoint balls" ) {
+    THEN( "Each ball has a closed surface with the background" ) {
+      REQUIRE( surfaces.size() == 2 );
+      REQUIRE( surfaces.count( std::make_pair( 0, 1 ) ) == 1 );
+      REQUIRE( surfaces.count( std::make_pair( 0, 2 ) ) == 1 );
+      REQUIRE( surfaces[ std::make_pair( 0, 1 ) ]->Euler() == 2 );
+      REQUIRE( surfaces[ std::make_pair( 0, 2 ) ]->Euler() == 2 );
+    }
+    THEN( "They are the surfaces of the binarized balls, with opposite orientation" ) {
+      params( "thresholdMin", 0 )( "thresholdMax", 255 )( "surfaceComponents", "All" );
+      auto bimage = SH3::makeBinaryImage( labels, params );
+      auto surface = SH3::makeIdxDigitalSurface( bimage, K, params );
+      REQUIRE( surface->nbVertices() == surfaces[ std::make_pair( 0, 1 ) ]->nbVertices()
+               + surfaces[ std::make_pair( 0, 2 ) ]->nbVertices() );
+      auto s = surfaces[ std::make_pair( 0, 2 ) ]->surfel( 0 );
+      REQUIRE( surface->getVertex( K.sOpp( s ) ) < surface->nbVertices() );
+    }
+  }
+}
+
+SCENARIO( "Shortcuts< HashedKhalimskySpaceND<3> > indexed digital surface", "[shortcuts][hashed]" )
+{
+  typedef HashedKhalimskySpaceND<3>                 HKSpace;
+  typedef Shortcuts< HKSpace >                      HSH3;
+  typedef Shortcuts< KhalimskySpaceND<3> >          SH3;
+
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep", 0.25 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeIdxDigitalSurface( binary_image, K, params );
+  auto HK              = HSH3::getKSpace( params );
+  auto hsurface        = HSH3::makeIdxDigitalSurface( binary_image, HK, params );
+  GIVEN( "A digitized sphere and a space whose surfel set is hashed" ) {
+    THEN( "The indexed digital surface is the one of the ordered space" ) {
+      REQUIRE( surface->nbVertices() > 0 );
+      REQUIRE( hsurface->nbVertices() == surface->nbVertices() );
+      REQUIRE( hsurface->nbArcs()     == surface->nbArcs() );
+      REQUIRE( hsurface->Euler()      == 2 );
+    }
+  }
+}
+
+SCENARIO( "Shortcuts< K3 > PLY export and import", "[shortcuts][ply]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeIdxDigitalSurface( binary_image, K, params );
+  SH3::RealVectors normals;
+  std::vector< double > ids;
+  for ( auto v : surface->allVertices() )
+    {
+      const SH3::SCell s = surface->surfel( v );
+      SH3::RealVector n;
+      n[ K.sOrthDir( s ) ] = K.sDirect( s, K.sOrthDir( s ) ) ? 1.0 : -1.0;
+      normals.push_back( n );
+      ids.push_back( v );
+    }
+  PLYAttributes attributes;
+  attributes.setVectors( "n", normals );
+  attributes.setScalars( "id", ids );
+  GIVEN( "An indexed digital surface saved with its normals as a PLY file" ) {
+    REQUIRE( SH3::savePLY( surface, "testShortcuts.ply", attributes ) );
+    PLYAttributes read;
+    auto rsurface = SH3::makeIdxDigitalSurfaceFromPLY( "testShortcuts.ply", K, &read );
+    THEN( "The surface read has the same surfels and attributes" ) {
+      REQUIRE( rsurface->nbVertices() == surface->nbVertices() );
+      REQUIRE( read.map().size() == 4 );
+      auto rnormals = read.vectors< SH3::RealVector >( "n" );
+      unsigned int nb_ok = 0;
+      for ( auto v : rsurface->allVertices() )
+        {
+          auto w = surface->getVertex( rsurface->surfel( v ) );
+          nb_ok += ( w < surface->nbVertices() && rnormals[ v ] == normals[ w ]
+                     && read.scalars( "id" )[ v ] == w ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == rsurface->nbVertices() );
+    }
+    THEN( "The pointels form a closed quad mesh" ) {
+      typedef SurfaceMeshReader< SH3::RealPoint, SH3::RealVector > Reader;
+      Reader::SurfaceMesh smesh;
+      REQUIRE( Reader::readPLY( "testShortcuts.ply", smesh ) );
+      REQUIRE( smesh.nbFaces() == surface->nbVertices() );
+      REQUIRE( smesh.nbVertices() == SH3::getPointelRange( SH3::makeDigitalSurface( surface ) ).size() );
+      REQUIRE( smesh.computeManifoldBoundaryEdges().empty() );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
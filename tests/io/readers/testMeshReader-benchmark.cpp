@@ -0,0 +1,272 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the import of OBJ, OFF and binary PLY mesh files.
+ *
+ * Usage: testMeshReader-benchmark [size]
+ * (default: a 512x512 grid, i.e. 522242 triangles). The triangulated
+ * grid is written as OBJ and OFF files, then imported by
+ * SurfaceMeshReader::readOBJ and MeshReader::importOFFFile,
+ * sequentially and with a ThreadPool, and by the former iostream
+ * based parsers (reproduced below). The same mesh is then written as
+ * a binary PLY file and read back by SurfaceMeshReader::readPLY and
+ * MeshReader::importPLYFile. The throughputs in MB/s of the text
+ * files are reported, so that the PLY imports are compared to them
+ * on the same amount of mesh data.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/readers/PLYReader.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/SurfaceMeshWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SurfaceMeshReader< Z3i::RealPoint, Z3i::RealVector > Reader;
+typedef Reader::SurfaceMesh SMesh;
+typedef Mesh< Z3i::RealPoint > RMesh;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The former parsing loop of SurfaceMeshReader::readOBJ (without
+ * normals): a std::istringstream and std::operator>> per line.
+ */
+bool legacyReadOBJ( std::istream & input, SMesh & smesh )
+{
+  typedef SMesh::Index Index;
+  std::vector< Z3i::RealPoint > vertices;
+  std::vector< std::vector< Index > > faces;
+  std::string linestr, keyword, indices;
+  Z3i::RealPoint p;
+  std::getline( input, linestr );
+  for ( ; input.good() && ! input.eof(); std::getline( input, linestr ) )
+    {
+      if ( linestr.empty() || linestr[ 0 ] == '#' ) continue;
+      std::istringstream lineinput( linestr );
+      std::operator>>( lineinput, keyword );
+      if ( keyword == "v" ) {
+        lineinput >> p[ 0 ] >> p[ 1 ] >> p[ 2 ];
+        vertices.push_back( p );
+      } else if ( keyword == "f" ) {
+        std::vector< Index > face;
+        while ( ! lineinput.eof() ) {
+          std::operator>>( lineinput, indices );
+          if ( indices.empty() ) break;
+          auto vtxinfo = Reader::split( indices, '/' );
+          if ( vtxinfo.size() == 0 ) break;
+          face.push_back( std::stoi( vtxinfo[ 0 ] ) - 1 );
+          indices = "";
+        }
+        if ( ! face.empty() && Reader::verifyIndicesUniqueness( face ) )
+          faces.push_back( face );
+      }
+      keyword = ""; linestr = "";
+    }
+  return smesh.init( vertices.begin(), vertices.end(), faces.begin(), faces.end() );
+}
+
+/**
+ * The former parsing loop of MeshReader::importOFFFile (without
+ * colors): std::operator>> on a std::ifstream.
+ */
+void legacyImportOFF( const std::string & filename, RMesh & mesh )
+{
+  std::ifstream infile( filename.c_str() );
+  std::string str;
+  getline( infile, str );
+  do getline( infile, str ); while ( infile.good() && ( str[ 0 ] == '#' || str == "" ) );
+  std::istringstream str_in( str );
+  int nbPoints, nbFaces;
+  str_in >> nbPoints >> nbFaces;
+  for ( int i = 0; i < nbPoints; i++ )
+    {
+      Z3i::RealPoint p;
+      infile >> p[ 0 ] >> p[ 1 ] >> p[ 2 ];
+      mesh.addVertex( p );
+      getline( infile, str );
+    }
+  for ( int i = 0; i < nbFaces; i++ )
+    {
+      unsigned int n, index;
+      infile >> n;
+      RMesh::MeshFace face;
+      for ( unsigned int j = 0; j < n; j++ )
+        {
+          infile >> index;
+          face.push_back( index );
+        }
+      getline( infile, str );
+      mesh.addFace( face );
+    }
+}
+
+/// Reports the throughput of an import.
+void report( const std::string & what, double ms, double bytes )
+{
+  trace.info() << what << ": " << ms << " ms, "
+               << ( bytes / ( 1024.0 * 1024.0 ) ) / ( ms / 1000.0 ) << " MB/s"
+               << std::endl;
+}
+
+/// @return the size of a file in bytes.
+double fileSize( const std::string & filename )
+{
+  std::ifstream in( filename.c_str(), std::ifstream::ate | std::ifstream::binary );
+  return double( in.tellg() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking SurfaceMeshReader and MeshReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int n = argc > 1 ? atoi( argv[ 1 ] ) : 512;
+  {
+    std::ofstream obj( "benchmark.obj" );
+    std::ofstream off( "benchmark.off" );
+    off << "OFF\n" << n * n << " " << 2 * ( n - 1 ) * ( n - 1 ) << " 0\n";
+    obj.precision( 9 );
+    off.precision( 9 );
+    for ( int y = 0; y < n; ++y )
+      for ( int x = 0; x < n; ++x )
+        {
+          const double z = 0.25 * std::sin( 0.05 * x ) * std::cos( 0.07 * y );
+          obj << "v " << x * 0.01 << " " << y * 0.01 << " " << z << "\n";
+          off << x * 0.01 << " " << y * 0.01 << " " << z << "\n";
+        }
+    for ( int y = 0; y + 1 < n; ++y )
+      for ( int x = 0; x + 1 < n; ++x )
+        {
+          const int v = y * n + x;
+          obj << "f " << v + 1 << " " << v + 2 << " " << v + n + 1 << "\n"
+              << "f " << v + 2 << " " << v + n + 2 << " " << v + n + 1 << "\n";
+          off << "3 " << v << " " << v + 1 << " " << v + n << "\n"
+              << "3 " << v + 1 << " " << v + n + 1 << " " << v + n << "\n";
+        }
+  }
+  const double objBytes = fileSize( "benchmark.obj" );
+  const double offBytes = fileSize( "benchmark.off" );
+  trace.info() << "OBJ " << objBytes << " bytes, OFF " << offBytes << " bytes" << std::endl;
+
+  ThreadPool pool;
+  trace.info() << pool.size() << " threads" << std::endl;
+  bool res = true;
+  Clock c;
+
+  SMesh legacy, stream, file, parallel;
+  c.startClock();
+  {
+    std::ifstream input( "benchmark.obj" );
+    res = legacyReadOBJ( input, legacy ) && res;
+  }
+  report( "OBJ legacy loop             ", c.stopClock(), objBytes );
+  c.startClock();
+  {
+    std::ifstream input( "benchmark.obj" );
+    res = Reader::readOBJ( input, stream ) && res;
+  }
+  report( "OBJ readOBJ( istream )      ", c.stopClock(), objBytes );
+  c.startClock();
+  res = Reader::readOBJ( "benchmark.obj", file ) && res;
+  report( "OBJ readOBJ( file )         ", c.stopClock(), objBytes );
+  c.startClock();
+  res = Reader::readOBJ( "benchmark.obj", parallel, &pool ) && res;
+  report( "OBJ readOBJ( file, pool )   ", c.stopClock(), objBytes );
+  for ( const SMesh * m : { &stream, &file, &parallel } )
+    res = res && m->positions() == legacy.positions()
+      && m->allIncidentVertices() == legacy.allIncidentVertices();
+
+  RMesh offLegacy, offSeq, offPar;
+  c.startClock();
+  legacyImportOFF( "benchmark.off", offLegacy );
+  report( "OFF legacy loop             ", c.stopClock(), offBytes );
+  c.startClock();
+  res = MeshReader< Z3i::RealPoint >::importOFFFile( "benchmark.off", offSeq ) && res;
+  report( "OFF importOFFFile           ", c.stopClock(), offBytes );
+  c.startClock();
+  res = MeshReader< Z3i::RealPoint >::importOFFFile( "benchmark.off", offPar, false, &pool ) && res;
+  report( "OFF importOFFFile( pool )   ", c.stopClock(), offBytes );
+  for ( const RMesh * m : { &offSeq, &offPar } )
+    {
+      res = res && m->nbVertex() == offLegacy.nbVertex() && m->nbFaces() == offLegacy.nbFaces();
+      for ( unsigned int v = 0; res && v < m->nbVertex(); ++v )
+        res = m->getVertex( v ) == offLegacy.getVertex( v );
+      for ( unsigned int f = 0; res && f < m->nbFaces(); ++f )
+        res = m->getFace( f ) == offLegacy.getFace( f );
+    }
+
+  {
+    std::ofstream ply( "benchmark.ply", std::ios::out | std::ios::binary );
+    res = SurfaceMeshWriter< Z3i::RealPoint, Z3i::RealVector >::writePLY( ply, legacy ) && res;
+  }
+  trace.info() << "PLY " << fileSize( "benchmark.ply" ) << " bytes" << std::endl;
+  {
+    c.startClock();
+    PLYReader ply( "benchmark.ply" );
+    std::vector< Z3i::RealPoint > positions;
+    std::vector< std::vector< unsigned int > > faces;
+    res = ply.readVectors( "vertex", "", positions )
+      && ply.readList( "face", "vertex_indices", faces ) && res;
+    report( "PLY PLYReader (OBJ bytes)   ", c.stopClock(), objBytes );
+  }
+  SMesh plyMesh;
+  c.startClock();
+  res = Reader::readPLY( "benchmark.ply", plyMesh ) && res;
+  report( "PLY readPLY (OBJ bytes)     ", c.stopClock(), objBytes );
+  res = res && plyMesh.positions() == legacy.positions()
+    && plyMesh.allIncidentVertices() == legacy.allIncidentVertices();
+  RMesh plyRMesh;
+  c.startClock();
+  res = MeshReader< Z3i::RealPoint >::importPLYFile( "benchmark.ply", plyRMesh ) && res;
+  report( "PLY importPLYFile (OFF bytes)", c.stopClock(), offBytes );
+  res = res && plyRMesh.nbVertex() == offLegacy.nbVertex() && plyRMesh.nbFaces() == offLegacy.nbFaces();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
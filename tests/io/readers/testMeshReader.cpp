@@ -29,9 +29,18 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/readers/MeshTextParser.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
 #include "DGtal/helpers/StdDefs.h"
 
 #include "ConfigTest.h"
@@ -129,6 +138,209 @@ bool testMeshReader()
   return nbok == nb;
 }
 
+/**
+ * Compares the numbers parsed by MeshTextParser with std::strtod.
+ */
+bool testMeshTextParser()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing MeshTextParser ..." );
+  const char * reals[] = { "0", "-0", "1", "+2", "0.1", "-3.25", "1.", ".5", "1e3",
+                           "2.5E-3", "6.02214076e23", "1e-300", "4.9e-324", "1.7976931348623157e308",
+                           "0.30000000000000004", "123456789012345678901234567890",
+                           "0.000000000000000000000000001", "9007199254740993", "inf", "-infinity",
+                           "3e", "7e+", "1.5/2" };
+  for ( const char * str : reals )
+    {
+      const char * p = str;
+      const char * end = str + std::strlen( str );
+      double x;
+      char * parsed;
+      const double y = std::strtod( str, &parsed );
+      const bool ok = MeshTextParser::parseReal( p, end, x );
+      nb++;
+      nbok += ( ok && x == y && p == parsed
+                && std::signbit( x ) == std::signbit( y ) ) ? 1 : 0;
+    }
+  const char * notReals[] = { "", "-", ".", "e5", "/1", "abc" };
+  for ( const char * str : notReals )
+    {
+      const char * p = str;
+      double x;
+      nb++;
+      nbok += ( ! MeshTextParser::parseReal( p, str + std::strlen( str ), x ) && p == str ) ? 1 : 0;
+    }
+  const char * integers = "12 -7 +3 x";
+  const char * p = integers;
+  const char * end = integers + std::strlen( integers );
+  long i, j, k, l;
+  nb++;
+  nbok += ( MeshTextParser::parseInteger( p, end, i )
+            && MeshTextParser::parseInteger( p = MeshTextParser::skipBlanks( p, end ), end, j )
+            && MeshTextParser::parseInteger( p = MeshTextParser::skipBlanks( p, end ), end, k )
+            && ! MeshTextParser::parseInteger( p = MeshTextParser::skipBlanks( p, end ), end, l )
+            && i == 12 && j == -7 && k == 3 && *p == 'x' ) ? 1 : 0;
+
+  const std::string text = "a\nbb\n\nccc\ndddd";
+  const char * tb = text.data();
+  const char * te = tb + text.size();
+  const std::vector< const char * > bounds = MeshTextParser::splitLines( tb, te, 4 );
+  bool linesOk = bounds.size() == 5 && bounds.front() == tb && bounds.back() == te;
+  for ( std::size_t b = 1; b + 1 < bounds.size(); ++b )
+    linesOk = linesOk && bounds[ b - 1 ] <= bounds[ b ] && bounds[ b ][ -1 ] == '\n';
+  nb++;
+  nbok += linesOk ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parsed numbers and lines" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Imports OFF files sequentially and with a ThreadPool.
+ */
+bool testOFFImport()
+{
+  typedef Mesh<Z3i::RealPoint> RMesh;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing OFF import ..." );
+  const int n = 50;
+  {
+    std::ofstream out( "testMeshReader.off" );
+    out << "OFF\n# a comment\n\n" << n * n << " " << 2 * ( n - 1 ) * ( n - 1 ) << " 0\n";
+    for ( int y = 0; y < n; ++y )
+      for ( int x = 0; x < n; ++x )
+        out << x * 0.1 << " " << y * 1e-3 << " " << -x * y * 0.25 << "\n";
+    for ( int y = 0; y + 1 < n; ++y )
+      for ( int x = 0; x + 1 < n; ++x )
+        {
+          const int v = y * n + x;
+          out << "3 " << v << " " << v + 1 << " " << v + n << "\n";
+          out << "3 " << v + 1 << " " << v + n + 1 << " " << v + n;
+          if ( x % 2 == 0 ) out << " 1.0 0.5 0.0";
+          if ( x % 4 == 0 ) out << " 0.5";
+          out << "\n";
+        }
+  }
+  {
+    // The same mesh with vertices and faces spanning several lines.
+    std::ofstream out( "testMeshReader-split.off" );
+    out << "OFF\n" << 4 << " " << 2 << " 0\n";
+    out << "0 0\n0\n1 0 0\n0 1 0\n1 1 0\n3 0 1\n2\n3 1 3 2 1.0 0.0 0.0\n";
+  }
+  ThreadPool pool( 3 );
+  RMesh seq( true ), par( true ), inv;
+  nb++;
+  nbok += MeshReader<Z3i::RealPoint>::importOFFFile( "testMeshReader.off", seq ) ? 1 : 0;
+  nb++;
+  nbok += MeshReader<Z3i::RealPoint>::importOFFFile( "testMeshReader.off", par, false, &pool ) ? 1 : 0;
+  nb++;
+  nbok += MeshReader<Z3i::RealPoint>::importOFFFile( "testMeshReader.off", inv, true, &pool ) ? 1 : 0;
+  bool same = seq.nbVertex() == (unsigned int) ( n * n )
+    && seq.nbFaces() == (unsigned int) ( 2 * ( n - 1 ) * ( n - 1 ) )
+    && par.nbVertex() == seq.nbVertex() && par.nbFaces() == seq.nbFaces()
+    && inv.nbFaces() == seq.nbFaces();
+  for ( unsigned int v = 0; same && v < seq.nbVertex(); ++v )
+    same = seq.getVertex( v ) == par.getVertex( v );
+  for ( unsigned int f = 0; same && f < seq.nbFaces(); ++f )
+    {
+      RMesh::MeshFace face = seq.getFace( f );
+      same = face == par.getFace( f ) && seq.getFaceColor( f ) == par.getFaceColor( f );
+      std::reverse( face.begin(), face.end() );
+      same = same && face == inv.getFace( f );
+    }
+  nb++;
+  nbok += ( same && seq.getVertex( n + 3 ) == Z3i::RealPoint( 0.3, 1e-3, -0.75 )
+            && seq.getFaceColor( 0 ) == Color::White
+            && seq.getFaceColor( 1 ) == Color( 255, 127, 0, 127 )
+            && seq.getFaceColor( 3 ) == Color::White
+            && seq.getFaceColor( 5 ) == Color( 255, 127, 0, 255 )
+            && seq.getFaceColor( 9 ) == Color( 255, 127, 0, 127 ) ) ? 1 : 0;
+
+  RMesh split( true ), splitPar( true );
+  nb++;
+  nbok += ( MeshReader<Z3i::RealPoint>::importOFFFile( "testMeshReader-split.off", split )
+            && MeshReader<Z3i::RealPoint>::importOFFFile( "testMeshReader-split.off", splitPar, false, &pool )
+            && split.nbVertex() == 4 && split.nbFaces() == 2
+            && splitPar.nbVertex() == 4 && splitPar.nbFaces() == 2
+            && split.getVertex( 3 ) == Z3i::RealPoint( 1, 1, 0 )
+            && split.getFace( 1 ) == RMesh::MeshFace( { 1, 3, 2 } )
+            && splitPar.getFace( 0 ) == RMesh::MeshFace( { 0, 1, 2 } )
+            && split.getFaceColor( 1 ) == Color( 255, 0, 0, 255 ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sequential and parallel OFF imports" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Reads OBJ streams and files sequentially and with a ThreadPool.
+ */
+bool testOBJImport()
+{
+  typedef SurfaceMeshReader< Z3i::RealPoint, Z3i::RealVector > Reader;
+  typedef Reader::SurfaceMesh SMesh;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing OBJ import ..." );
+  std::ostringstream obj;
+  obj << "# grid\n";
+  const int n = 40;
+  for ( int y = 0; y < n; ++y )
+    for ( int x = 0; x < n; ++x )
+      obj << "v " << x << " " << y * 0.5 << " " << x * y * 1e-2 << "\n";
+  for ( int y = 0; y < n; ++y )
+    for ( int x = 0; x < n; ++x )
+      obj << "vn 0 0 " << ( x + y ) % 2 << "\n";
+  obj << "vt 0.5 0.5\n\n";
+  for ( int y = 0; y + 1 < n; ++y )
+    for ( int x = 0; x + 1 < n; ++x )
+      {
+        const int v = y * n + x + 1;
+        obj << "f " << v << "//" << v << " " << v + 1 << "//" << v + 1
+            << " " << v + n << "//" << v + n << "\n";
+        obj << "f\t" << v + 1 << "/1/" << v + 1 << " " << v + n + 1 << " "
+            << v + n << "/1\n";
+      }
+  obj << "f 1 2 1\n"; // a face with duplicate vertices is skipped.
+  obj << "v 1 2 3"; // a last line without line feed.
+  {
+    std::ofstream out( "testMeshReader.obj" );
+    out << obj.str();
+  }
+  ThreadPool pool( 3 );
+  SMesh sstream, sfile, spar;
+  std::istringstream input( obj.str() );
+  nb++;
+  nbok += Reader::readOBJ( input, sstream ) ? 1 : 0;
+  nb++;
+  nbok += Reader::readOBJ( "testMeshReader.obj", sfile ) ? 1 : 0;
+  nb++;
+  nbok += Reader::readOBJ( "testMeshReader.obj", spar, &pool ) ? 1 : 0;
+  bool same = sstream.nbVertices() == (SMesh::Size) ( n * n + 1 )
+    && sstream.nbFaces() == (SMesh::Size) ( 2 * ( n - 1 ) * ( n - 1 ) );
+  for ( const SMesh * m : { &sfile, &spar } )
+    {
+      same = same && m->nbVertices() == sstream.nbVertices()
+        && m->nbFaces() == sstream.nbFaces()
+        && m->positions() == sstream.positions()
+        && m->allIncidentVertices() == sstream.allIncidentVertices()
+        && m->faceNormals() == sstream.faceNormals();
+    }
+  nb++;
+  nbok += ( same && sstream.position( n + 2 ) == Z3i::RealPoint( 2, 0.5, 0.02 )
+            && sstream.position( n * n ) == Z3i::RealPoint( 1, 2, 3 )
+            && sstream.incidentVertices( 1 ) == SMesh::Vertices( { 1, 1 + n, n } )
+            && sstream.faceNormals().size() == sstream.nbFaces()
+            && sstream.vertexNormals().empty() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "stream, file and parallel OBJ imports" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -140,7 +352,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshReader(); // && ... other tests
+  bool res = testMeshReader() && testMeshTextParser()
+    && testOFFImport() && testOBJImport(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,288 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPLYReader.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes PLYReader and PLYWriter, and the PLY
+ * import/export of Mesh and SurfaceMesh.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/PLYAttributes.h"
+#include "DGtal/io/readers/PLYReader.h"
+#include "DGtal/io/writers/PLYWriter.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/writers/MeshWriter.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/SurfaceMeshWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes PLYReader and PLYWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Writes a PLY file with all the scalar types by hand, then reads it
+ * back with the decoding services and the zero-copy accessors.
+ */
+bool testPLYReaderWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing PLYWriter and PLYReader ..." );
+  {
+    std::ofstream out( "testPLYReader.ply", std::ios::out | std::ios::binary );
+    PLYWriter ply( out );
+    ply.addComment( "a comment" );
+    ply.addElement( "point", 3 );
+    ply.addProperty( "a", "char" );
+    ply.addProperty( "b", "ushort" );
+    ply.addProperty( "c", "int32" );
+    ply.addProperty( "x", "float" );
+    ply.addProperty( "y", "double" );
+    ply.addProperty( "z", "uint8" );
+    ply.addElement( "poly", 2 );
+    ply.addProperty( "id", "short" );
+    ply.addListProperty( "indices", "uchar", "uint" );
+    ply.addProperty( "w", "double" );
+    ply.writeHeader();
+    for ( int i = 0; i < 3; ++i )
+      {
+        ply.put( (DGtal::int8_t) -i );
+        ply.put( (DGtal::uint16_t) ( 1000 + i ) );
+        ply.put( (DGtal::int32_t) ( -100000 * i ) );
+        ply.put( 0.5f * i );
+        ply.put( 0.25 * i );
+        ply.put( (DGtal::uint8_t) ( 200 + i ) );
+      }
+    ply.put( (DGtal::int16_t) -7 );
+    ply.put( (DGtal::uint8_t) 3 );
+    ply.put( (DGtal::uint32_t) 0 ); ply.put( (DGtal::uint32_t) 1 ); ply.put( (DGtal::uint32_t) 2 );
+    ply.put( 1.5 );
+    ply.put( (DGtal::int16_t) 8 );
+    ply.put( (DGtal::uint8_t) 1 );
+    ply.put( (DGtal::uint32_t) 2 );
+    ply.put( -2.5 );
+    nb++;
+    nbok += ply.flush() ? 1 : 0;
+  }
+  PLYReader ply( "testPLYReader.ply" );
+  trace.info() << ply << std::endl;
+  nb++;
+  nbok += ( ply.isValid() && ply.elements() == std::vector< std::string >( { "point", "poly" } )
+            && ply.size( "point" ) == 3 && ply.size( "poly" ) == 2 && ply.size( "none" ) == 0
+            && ply.comments().size() == 1 && ply.comments()[ 0 ] == "a comment"
+            && ply.properties( "poly" ) == std::vector< std::string >( { "id", "indices", "w" } )
+            && ply.hasProperty( "point", "z" ) && ! ply.hasProperty( "point", "w" ) ) ? 1 : 0;
+  std::vector< int > a, b, c, id;
+  std::vector< double > w;
+  std::vector< Z3i::RealPoint > xyz;
+  std::vector< std::vector< unsigned int > > indices;
+  nb++;
+  nbok += ( ply.readProperty( "point", "a", a ) && ply.readProperty( "point", "b", b )
+            && ply.readProperty( "point", "c", c ) && ply.readVectors( "point", "", xyz )
+            && ply.readProperty( "poly", "id", id ) && ply.readProperty( "poly", "w", w )
+            && ply.readList( "poly", "indices", indices )
+            && ! ply.readProperty( "poly", "indices", id ) && ! ply.readVectors( "poly", "", xyz ) ) ? 1 : 0;
+  ply.readVectors( "point", "", xyz );
+  nb++;
+  nbok += ( a == std::vector< int >( { 0, -1, -2 } ) && b == std::vector< int >( { 1000, 1001, 1002 } )
+            && c == std::vector< int >( { 0, -100000, -200000 } )
+            && xyz[ 2 ] == Z3i::RealPoint( 1.0, 0.5, 202 )
+            && id == std::vector< int >( { -7, 8 } ) && w == std::vector< double >( { 1.5, -2.5 } )
+            && indices.size() == 2 && indices[ 0 ] == std::vector< unsigned int >( { 0, 1, 2 } )
+            && indices[ 1 ] == std::vector< unsigned int >( { 2 } ) ) ? 1 : 0;
+  // Zero-copy access to the fixed-size records.
+  const char * y = ply.data( "point" ) + ply.offset( "point", "y" );
+  bool direct = ply.stride( "point" ) == 1 + 2 + 4 + 4 + 8 + 1
+    && ply.stride( "poly" ) == 0 && ply.offset( "poly", "w" ) == std::size_t( -1 )
+    && ply.offset( "poly", "id" ) == 0 && ply.offset( "point", "y" ) == 11;
+  for ( std::size_t i = 0; i < ply.size( "point" ); ++i, y += ply.stride( "point" ) )
+    {
+      double v;
+      std::memcpy( &v, y, sizeof( double ) );
+      direct = direct && v == 0.25 * i;
+    }
+  nb++;
+  nbok += direct ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "write then read all PLY types" << std::endl;
+  // Truncated, ascii and missing files are rejected.
+  {
+    std::ifstream in( "testPLYReader.ply", std::ios::in | std::ios::binary );
+    std::string content( ( std::istreambuf_iterator<char>( in ) ),
+                         std::istreambuf_iterator<char>() );
+    std::ofstream truncated( "testPLYReader-truncated.ply", std::ios::out | std::ios::binary );
+    truncated.write( content.data(), content.size() - 3 );
+    std::ofstream ascii( "testPLYReader-ascii.ply" );
+    ascii << "ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nend_header\n1\n";
+  }
+  for ( const char * name : { "testPLYReader-truncated.ply", "testPLYReader-ascii.ply",
+                              "testPLYReader-none.ply" } )
+    {
+      bool thrown = false;
+      try { PLYReader bad( name ); }
+      catch ( const IOException & ) { thrown = true; }
+      nb++;
+      nbok += thrown ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated, ascii and missing files throw" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Round trip of a SurfaceMesh with normals and attributes.
+ */
+bool testSurfaceMeshPLY()
+{
+  typedef SurfaceMeshReader< Z3i::RealPoint, Z3i::RealVector > Reader;
+  typedef SurfaceMeshWriter< Z3i::RealPoint, Z3i::RealVector > Writer;
+  typedef Reader::SurfaceMesh SMesh;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing SurfaceMesh PLY export and import ..." );
+  const int n = 20;
+  std::vector< Z3i::RealPoint > positions;
+  std::vector< Z3i::RealVector > normals;
+  std::vector< SMesh::Vertices > faces;
+  for ( int y = 0; y < n; ++y )
+    for ( int x = 0; x < n; ++x )
+      {
+        positions.push_back( Z3i::RealPoint( x, y * 0.5, x * y * 1e-2 ) );
+        normals.push_back( Z3i::RealVector( 0, ( x + y ) % 2, 1 ) );
+      }
+  for ( int y = 0; y + 1 < n; ++y )
+    for ( int x = 0; x + 1 < n; ++x )
+      {
+        const SMesh::Index v = y * n + x;
+        faces.push_back( { v, v + 1, v + 1 + n, v + n } );
+      }
+  SMesh smesh( positions.begin(), positions.end(), faces.begin(), faces.end() );
+  smesh.setVertexNormals( normals.begin(), normals.end() );
+  smesh.computeFaceNormalsFromPositions();
+  std::vector< double > curvatures( smesh.nbVertices() ), areas( smesh.nbFaces() );
+  for ( std::size_t i = 0; i < curvatures.size(); ++i ) curvatures[ i ] = 1.0 / ( i + 1 );
+  for ( std::size_t i = 0; i < areas.size(); ++i )      areas[ i ] = smesh.faceArea( i );
+  PLYAttributes vertexAttributes, faceAttributes;
+  vertexAttributes.setScalars( "H", curvatures );
+  vertexAttributes.setVectors( "d", positions );
+  faceAttributes.setScalars( "area", areas );
+  {
+    std::ofstream out( "testPLYReader-smesh.ply", std::ios::out | std::ios::binary );
+    nb++;
+    nbok += Writer::writePLY( out, smesh, vertexAttributes, faceAttributes ) ? 1 : 0;
+    PLYAttributes wrong;
+    wrong.setScalars( "H", areas );
+    std::ostringstream none;
+    nb++;
+    nbok += Writer::writePLY( none, smesh, wrong ) ? 0 : 1;
+  }
+  SMesh rmesh;
+  PLYAttributes rVertexAttributes, rFaceAttributes;
+  nb++;
+  nbok += Reader::readPLY( "testPLYReader-smesh.ply", rmesh,
+                           &rVertexAttributes, &rFaceAttributes ) ? 1 : 0;
+  nb++;
+  nbok += ( rmesh.positions() == smesh.positions()
+            && rmesh.allIncidentVertices() == smesh.allIncidentVertices()
+            && rmesh.vertexNormals() == smesh.vertexNormals()
+            && rmesh.faceNormals() == smesh.faceNormals() ) ? 1 : 0;
+  nb++;
+  nbok += ( rVertexAttributes.map().size() == 4
+            && rVertexAttributes.scalars( "H" ) == curvatures
+            && rVertexAttributes.vectors< Z3i::RealPoint >( "d" ) == positions
+            && rFaceAttributes.map().size() == 1
+            && rFaceAttributes.scalars( "area" ) == areas ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "SurfaceMesh round trip" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Round trip of a Mesh with face colors, through the file extension.
+ */
+bool testMeshPLY()
+{
+  typedef Mesh< Z3i::RealPoint > RMesh;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Mesh PLY export and import ..." );
+  RMesh mesh( true );
+  mesh.addVertex( Z3i::RealPoint( 0, 0, 0 ) );
+  mesh.addVertex( Z3i::RealPoint( 1, 0, 0.5 ) );
+  mesh.addVertex( Z3i::RealPoint( 1, 1, -0.25 ) );
+  mesh.addVertex( Z3i::RealPoint( 0, 1, 3 ) );
+  mesh.addTriangularFace( 0, 1, 2, Color( 255, 0, 0, 127 ) );
+  mesh.addQuadFace( 0, 1, 2, 3, Color( 10, 20, 30 ) );
+  nb++;
+  nbok += ( mesh >> "testPLYReader-mesh.ply" ) ? 1 : 0;
+  RMesh rmesh( true ), inverted( true );
+  nb++;
+  nbok += ( rmesh << "testPLYReader-mesh.ply" ) ? 1 : 0;
+  nb++;
+  nbok += MeshReader< Z3i::RealPoint >::importPLYFile( "testPLYReader-mesh.ply", inverted, true ) ? 1 : 0;
+  bool same = rmesh.nbVertex() == mesh.nbVertex() && rmesh.nbFaces() == mesh.nbFaces();
+  for ( unsigned int i = 0; same && i < mesh.nbVertex(); ++i )
+    same = rmesh.getVertex( i ) == mesh.getVertex( i );
+  for ( unsigned int i = 0; same && i < mesh.nbFaces(); ++i )
+    same = rmesh.getFace( i ) == mesh.getFace( i )
+      && rmesh.getFaceColor( i ) == mesh.getFaceColor( i );
+  nb++;
+  nbok += ( same && inverted.getFace( 0 ) == RMesh::MeshFace( { 2, 1, 0 } ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Mesh round trip" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PLYReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPLYReaderWriter() && testSurfaceMeshPLY() && testMeshPLY(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the import of .vol and .longvol files.
+ *
+ * Usage: testVolReader-benchmark [size]
+ * (default: a 256^3 volume). A volume of random balls is exported
+ * uncompressed and compressed, then imported by VolReader and
+ * LongvolReader and by the former voxel by voxel import loop
+ * (reproduced below), and the throughputs in MB/s of uncompressed
+ * voxel data are reported. The chunked (Version 4) files are then
+ * written and read sequentially and with a ThreadPool.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char >   Image;
+typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::uint64_t > LImage;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The former import loop of VolReader and LongvolReader: the payload
+ * is read byte by byte into a stringstream, inflated into another
+ * stringstream, and the values are set point by point.
+ */
+template < typename TImage >
+TImage legacyImport( const std::string & filename, const Z3i::Domain & domain,
+                     bool compressed )
+{
+  typedef typename TImage::Value Value;
+  FILE * fin = fopen( filename.c_str(), "rb" );
+  char buf[ 128 ];
+  for ( char * line = fgets( buf, 128, fin ); line && strcmp( line, ".\n" ) != 0;
+        line = fgets( line, 128, fin ) )
+    ;
+  TImage image( domain );
+  const long total = (long) domain.size();
+  const long totalbytes = total * (long) sizeof( Value );
+  std::stringstream main;
+  long count = 0;
+  while ( ( count < totalbytes ) && ( fin ) )
+    {
+      unsigned char c = getc( fin );
+      main << c;
+      count++;
+    }
+  fclose( fin );
+  std::stringstream uncompressed;
+  if ( compressed )
+    {
+      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+      in.push( boost::iostreams::zlib_decompressor() );
+      in.push( main );
+      boost::iostreams::copy( in, uncompressed );
+    }
+  std::stringstream & data = compressed ? uncompressed : main;
+  typename Z3i::Domain::ConstIterator it = domain.begin();
+  for ( long i = 0; i < total; ++i, ++it )
+    {
+      Value val = 0;
+      for ( unsigned int b = 0; b < sizeof( Value ); ++b )
+        val |= static_cast<Value>( static_cast<unsigned char>( data.get() ) ) << ( 8 * b );
+      image.setValue( *it, val );
+    }
+  return image;
+}
+
+/// Reports the throughput of an import.
+void report( const std::string & what, double ms, double bytes )
+{
+  trace.info() << what << ": " << ms << " ms, "
+               << ( bytes / ( 1024.0 * 1024.0 ) ) / ( ms / 1000.0 ) << " MB/s"
+               << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking VolReader and LongvolReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 256;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image image( domain );
+  LImage limage( domain );
+  srand( 0 );
+  for ( int b = 0; b < 32; ++b )
+    {
+      const Z3i::Point c( rand() % size, rand() % size, rand() % size );
+      const int r = 1 + rand() % std::max( 1, size / 6 );
+      const unsigned char v = static_cast<unsigned char>( 1 + rand() % 255 );
+      for ( auto p : domain )
+        if ( ( p - c ).squaredNorm() <= (Z3i::Point::Coordinate) ( r * r ) )
+          {
+            image.setValue( p, v );
+            limage.setValue( p, ( DGtal::uint64_t( v ) << 33 ) + v );
+          }
+    }
+  VolWriter< Image >::exportVol( "benchmark.vol", image, false );
+  VolWriter< Image >::exportVol( "benchmarkz.vol", image, true );
+  LongvolWriter< LImage >::exportLongvol( "benchmark.longvol", limage, false );
+  LongvolWriter< LImage >::exportLongvol( "benchmarkz.longvol", limage, true );
+
+  bool res = true;
+  const double volBytes  = double( domain.size() );
+  const double lvolBytes = double( domain.size() ) * sizeof( DGtal::uint64_t );
+  for ( int compressed = 0; compressed < 2; ++compressed )
+    {
+      const std::string suffix = compressed ? "z" : "";
+      const std::string kind   = compressed ? " compressed" : " raw";
+      Clock c;
+      c.startClock();
+      Image a = legacyImport< Image >( "benchmark" + suffix + ".vol", domain, compressed );
+      report( "Vol" + kind + " legacy loop", c.stopClock(), volBytes );
+      c.startClock();
+      Image b = VolReader< Image >::importVol( "benchmark" + suffix + ".vol" );
+      report( "Vol" + kind + " VolReader  ", c.stopClock(), volBytes );
+      res = res && std::equal( a.begin(), a.end(), image.begin() )
+        && std::equal( b.begin(), b.end(), image.begin() );
+
+      c.startClock();
+      LImage la = legacyImport< LImage >( "benchmark" + suffix + ".longvol", domain, compressed );
+      report( "Longvol" + kind + " legacy loop  ", c.stopClock(), lvolBytes );
+      c.startClock();
+      LImage lb = LongvolReader< LImage >::importLongvol( "benchmark" + suffix + ".longvol" );
+      report( "Longvol" + kind + " LongvolReader", c.stopClock(), lvolBytes );
+      res = res && std::equal( la.begin(), la.end(), limage.begin() )
+        && std::equal( lb.begin(), lb.end(), limage.begin() );
+    }
+
+  ThreadPool pool;
+  trace.info() << "Chunked files, " << pool.size() << " threads" << std::endl;
+  Clock c;
+  c.startClock();
+  VolWriter< Image >::exportVol( "benchmarkz.vol", image, true );
+  report( "Vol compressed write        ", c.stopClock(), volBytes );
+  c.startClock();
+  VolWriter< Image >::exportChunkedVol( "benchmarkc.vol", image );
+  report( "Vol chunked write           ", c.stopClock(), volBytes );
+  c.startClock();
+  VolWriter< Image >::exportChunkedVol( "benchmarkc.vol", image, functors::Identity(),
+                                        1 << 20, &pool );
+  report( "Vol chunked write (pool)    ", c.stopClock(), volBytes );
+  c.startClock();
+  Image cs = VolReader< Image >::importVol( "benchmarkc.vol" );
+  report( "Vol chunked VolReader       ", c.stopClock(), volBytes );
+  c.startClock();
+  Image cp = VolReader< Image >::importVol( "benchmarkc.vol", functors::Cast<unsigned char>(), &pool );
+  report( "Vol chunked VolReader (pool)", c.stopClock(), volBytes );
+  res = res && std::equal( cs.begin(), cs.end(), image.begin() )
+    && std::equal( cp.begin(), cp.end(), image.begin() );
+
+  c.startClock();
+  LongvolWriter< LImage >::exportChunkedLongvol( "benchmarkc.longvol", limage, functors::Identity(),
+                                                 1 << 17, &pool );
+  report( "Longvol chunked write (pool)        ", c.stopClock(), lvolBytes );
+  c.startClock();
+  LImage lcp = LongvolReader< LImage >::importLongvol( "benchmarkc.longvol",
+                                                       functors::Cast<DGtal::uint64_t>(), &pool );
+  report( "Longvol chunked LongvolReader (pool)", c.stopClock(), lvolBytes );
+  res = res && std::equal( lcp.begin(), lcp.end(), limage.begin() );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
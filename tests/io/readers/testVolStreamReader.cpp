@@ -0,0 +1,214 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolStreamReader.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes VolStreamReader and ImageFactoryFromVol.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageFactoryFromVol.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/io/readers/VolStreamReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+#include "DGtal/io/writers/RawWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes VolStreamReader and ImageFactoryFromVol.
+///////////////////////////////////////////////////////////////////////////////
+
+/// True if @a part equals @a whole on the domain of @a part.
+template <typename TPart, typename TWhole>
+bool sameValues( const TPart & part, const TWhole & whole )
+{
+  for ( auto p : part.domain() )
+    if ( part( p ) != whole( p ) )
+      return false;
+  return true;
+}
+
+TEST_CASE( "Testing VolStreamReader" )
+{
+  typedef ImageContainerBySTLVector< Domain, unsigned char > Image;
+  typedef ImageContainerBySTLMap< Domain, unsigned char > MapImage;
+  Domain domain( Point( -3, 2, 1 ), Point( 27, 20, 33 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( auto p : domain )
+    image.setValue( p, static_cast<unsigned char>( rand() % 256 ) );
+  VolWriter< Image >::exportVol( "testVolStreamReader.vol", image, false );
+  VolWriter< Image >::exportVol( "testVolStreamReaderz.vol", image, true );
+
+  const Domain subdomains[] = {
+    domain,
+    Domain( Point( 0, 5, 3 ), Point( 10, 15, 8 ) ),       // rows
+    Domain( Point( -3, 5, 3 ), Point( 27, 15, 8 ) ),      // planes rows
+    Domain( Point( -3, 2, 30 ), Point( 27, 20, 33 ) ),    // slab
+    Domain( Point( 27, 20, 1 ), Point( 27, 20, 33 ) ),    // column
+    Domain( Point( 1, 2, 3 ), Point( 1, 2, 3 ) ) };       // point
+
+  for ( int compressed = 0; compressed < 2; ++compressed )
+    {
+      VolStreamReader< Image > reader( compressed ? "testVolStreamReaderz.vol"
+                                       : "testVolStreamReader.vol" );
+      SECTION( compressed ? "Compressed sub-domains" : "Raw sub-domains" )
+        {
+          REQUIRE( reader.isValid() );
+          REQUIRE( reader.isCompressed() == ( compressed == 1 ) );
+          REQUIRE( reader.domain().lowerBound() == domain.lowerBound() );
+          REQUIRE( reader.domain().upperBound() == domain.upperBound() );
+          // Sub-domains out of the file order.
+          for ( const Domain & d : subdomains )
+            {
+              Image part = reader.readSubDomain( d );
+              REQUIRE( part.domain().size() == d.size() );
+              REQUIRE( sameValues( part, image ) );
+              MapImage mpart = VolStreamReader< MapImage >
+                ( compressed ? "testVolStreamReaderz.vol" : "testVolStreamReader.vol" )
+                .readSubDomain( d );
+              REQUIRE( sameValues( mpart, image ) );
+            }
+        }
+      SECTION( compressed ? "Compressed slabs" : "Raw slabs" )
+        {
+          std::size_t nb = 0;
+          for ( Integer z = domain.lowerBound()[ 2 ]; z <= domain.upperBound()[ 2 ]; z += 4 )
+            {
+              Image slab = reader.readSlab( z, z + 3 );
+              REQUIRE( slab.domain().lowerBound()[ 2 ] == z );
+              REQUIRE( sameValues( slab, image ) );
+              nb += slab.domain().size();
+            }
+          REQUIRE( nb == domain.size() );
+          REQUIRE( reader.slabDomain( 30, 100 ).upperBound()[ 2 ] == 33 );
+        }
+    }
+
+  SECTION( "Longvol and functor" )
+    {
+      typedef ImageContainerBySTLVector< Domain, DGtal::uint64_t > LImage;
+      LImage limage( domain );
+      for ( auto p : domain )
+        limage.setValue( p, ( DGtal::uint64_t( image( p ) ) << 40 ) + image( p ) );
+      LongvolWriter< LImage >::exportLongvol( "testVolStreamReader.longvol", limage, true );
+      VolStreamReader< LImage, DGtal::uint64_t > reader( "testVolStreamReader.longvol" );
+      LImage slab = reader.readSlab( 10, 12 );
+      REQUIRE( sameValues( slab, limage ) );
+
+      // The words must match the file voxel size.
+      REQUIRE_THROWS_AS( VolStreamReader< Image >( "testVolStreamReader.longvol" ),
+                         DGtal::IOException );
+      REQUIRE_THROWS_AS( ( VolStreamReader< LImage, DGtal::uint64_t >( "testVolStreamReader.vol" ) ),
+                         DGtal::IOException );
+    }
+
+  SECTION( "Raw files" )
+    {
+      typedef ImageContainerBySTLVector< Z2i::Domain, DGtal::uint16_t > Image2;
+      Image2 image2( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 40, 30 ) ) );
+      for ( auto p : image2.domain() )
+        image2.setValue( p, static_cast<DGtal::uint16_t>( rand() % 65536 ) );
+      RawWriter< Image2 >::exportRaw16( "testVolStreamReader.raw", image2 );
+      VolStreamReader< Image2, DGtal::uint16_t > reader
+        ( "testVolStreamReader.raw", Z2i::Vector( 41, 31 ) );
+      Z2i::Domain d( Z2i::Point( 3, 7 ), Z2i::Point( 35, 29 ) );
+      REQUIRE( sameValues( reader.readSubDomain( d ), image2 ) );
+      REQUIRE( sameValues( reader.readSlab( 0, 30 ), image2 ) );
+      REQUIRE_THROWS_AS( ( VolStreamReader< Image2, DGtal::uint16_t >
+                           ( "testVolStreamReader.raw", Z2i::Vector( 41, 32 ) )
+                           .readSlab( 31, 31 ) ),
+                         DGtal::IOException );
+    }
+
+  SECTION( "Truncated file" )
+    {
+      std::ifstream in( "testVolStreamReaderz.vol", std::ios::binary );
+      std::string data( ( std::istreambuf_iterator<char>( in ) ),
+                        std::istreambuf_iterator<char>() );
+      std::ofstream out( "testVolStreamReader-truncated.vol", std::ios::binary );
+      out << data.substr( 0, data.size() / 2 );
+      out.close();
+      VolStreamReader< Image > reader( "testVolStreamReader-truncated.vol" );
+      REQUIRE( sameValues( reader.readSlab( 1, 1 ), image ) );
+      REQUIRE_THROWS_AS( reader.readSlab( 33, 33 ), DGtal::IOException );
+    }
+}
+
+TEST_CASE( "Testing TiledImage over ImageFactoryFromVol" )
+{
+  typedef ImageContainerBySTLVector< Domain, unsigned char > Image;
+  Domain domain( Point( 0, 0, 0 ), Point( 31, 23, 39 ) );
+  Image image( domain );
+  srand( 1 );
+  for ( auto p : domain )
+    image.setValue( p, static_cast<unsigned char>( rand() % 256 ) );
+
+  for ( int compressed = 0; compressed < 2; ++compressed )
+    {
+      VolWriter< Image >::exportVol( "testImageFactoryFromVol.vol", image, compressed == 1 );
+      typedef ImageFactoryFromVol< Image > Factory;
+      typedef ImageCacheReadPolicyFIFO< Image, Factory > ReadPolicy;
+      typedef ImageCacheWritePolicyWT< Image, Factory > WritePolicy;
+      typedef TiledImage< Image, Factory, ReadPolicy, WritePolicy > Tiled;
+      BOOST_CONCEPT_ASSERT(( concepts::CImageFactory< Factory > ));
+      BOOST_CONCEPT_ASSERT(( concepts::CImage< Tiled > ));
+
+      Factory factory( "testImageFactoryFromVol.vol" );
+      ReadPolicy readPolicy( factory, 4 );
+      WritePolicy writePolicy( factory );
+      Tiled tiled( factory, readPolicy, writePolicy, 4 );
+      REQUIRE( factory.isValid() );
+      REQUIRE( tiled.domain().size() == domain.size() );
+      REQUIRE( sameValues( image, tiled ) );
+      // The range scans the values tile by tile.
+      std::size_t nb = 0, sum = 0, expected = 0;
+      for ( auto v : tiled.constRange() )
+        {
+          ++nb;
+          sum += v;
+        }
+      for ( auto v : image.constRange() )
+        expected += v;
+      REQUIRE( nb == domain.size() );
+      REQUIRE( sum == expected );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
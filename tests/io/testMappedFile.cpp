@@ -0,0 +1,84 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/MappedFile.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MappedFile.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing MappedFile" )
+{
+  std::string content( "header\n" );
+  for ( int i = 0; i < 10000; ++i )
+    content += static_cast<char>( i % 256 );
+  {
+    std::ofstream out( "testMappedFile.bin", std::ios::binary );
+    out.write( content.data(), std::streamsize( content.size() ) );
+    std::ofstream empty( "testMappedFileEmpty.bin", std::ios::binary );
+  }
+
+  SECTION( "Whole file and file from an offset" )
+    {
+      MappedFile file( "testMappedFile.bin" );
+      REQUIRE( file.isValid() );
+      REQUIRE( std::string( file.data(), file.size() ) == content );
+      MappedFile payload( "testMappedFile.bin", 7 );
+      REQUIRE( payload.isValid() );
+      REQUIRE( std::string( payload.data(), payload.size() ) == content.substr( 7 ) );
+      MappedFile end( "testMappedFile.bin", content.size() );
+      REQUIRE( end.size() == 0 );
+    }
+
+  SECTION( "Empty file" )
+    {
+      MappedFile file( "testMappedFileEmpty.bin" );
+      REQUIRE( file.isValid() );
+      REQUIRE( file.size() == 0 );
+      REQUIRE( ! file.isMapped() );
+    }
+
+  SECTION( "Missing file and offsets past the end are rejected" )
+    {
+      REQUIRE_THROWS_AS( MappedFile( "testMappedFileMissing.bin" ), IOException );
+      REQUIRE_THROWS_AS( MappedFile( "testMappedFile.bin", content.size() + 1 ), IOException );
+      REQUIRE_THROWS_AS( MappedFile( "testMappedFileEmpty.bin", 1 ), IOException );
+    }
+}
+
+/** @ingroup Tests **/
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <limits>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -38,6 +39,12 @@
 #include "DGtal/io/writers/VolWriter.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/io/readers/VolStreamReader.h"
+#include "DGtal/base/ThreadPool.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -111,4 +118,173 @@ TEST_CASE( "Testing CompressedLongvol" )
     }
 }
 
+/// Doubles and shifts values while importing.
+struct DoubleFunctor
+{
+  int operator()( unsigned char v ) const { return 2 * int( v ) + 1; }
+  DGtal::uint64_t operator()( DGtal::uint64_t v ) const { return 2 * v + 1; }
+};
+
+TEST_CASE( "Testing block import of VolReader and LongvolReader" )
+{
+  // More voxels than one import block of Vol (2^20) and Longvol (2^17).
+  Domain domain(Point(-3,0,2), Point(107,109,112));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Domain, int> IntImage;
+  typedef ImageContainerBySTLMap<Domain, int> MapImage;
+  Image image(domain);
+  srand( 0 );
+  for(auto & v: image) v = static_cast<unsigned char>( rand() % 256 );
+  VolWriter<Image>::exportVol("testblock.vol", image, false);
+  VolWriter<Image>::exportVol("testblockz.vol", image);
+
+  SECTION("Vol import into the image buffer or point by point")
+    {
+      for( std::string name: { "testblock.vol", "testblockz.vol" } )
+        {
+          Image read = VolReader<Image>::importVol(name);
+          REQUIRE( checkImage(image, read) );
+          IntImage readInt = VolReader<IntImage, DoubleFunctor>::importVol(name);
+          MapImage readMap = VolReader<MapImage, DoubleFunctor>::importVol(name);
+          bool ok = true;
+          for(auto p: domain)
+            ok = ok && readInt(p) == 2 * int( image(p) ) + 1 && readMap(p) == readInt(p);
+          REQUIRE( ok );
+        }
+    }
+
+  SECTION("Truncated Vol files are rejected")
+    {
+      std::ifstream in("testblock.vol", std::ios::binary);
+      std::string content( (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>() );
+      std::ofstream out("testtruncated.vol", std::ios::binary);
+      out.write( content.data(), std::streamsize( content.size() - 10 ) );
+      out.close();
+      REQUIRE_THROWS_AS( VolReader<Image>::importVol("testtruncated.vol"), IOException );
+    }
+
+  SECTION("Longvol import into the image buffer or point by point")
+    {
+      Domain ldomain(Point(0,0,0), Point(59,59,59));
+      typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LImage;
+      typedef ImageContainerBySTLMap<Domain, DGtal::uint64_t> LMapImage;
+      LImage limage(ldomain);
+      for(auto & v: limage)
+        v = ( DGtal::uint64_t( rand() ) << 40 ) ^ DGtal::uint64_t( rand() );
+      LongvolWriter<LImage>::exportLongvol("testblock.lvol", limage, false);
+      LongvolWriter<LImage>::exportLongvol("testblockz.lvol", limage);
+      for( std::string name: { "testblock.lvol", "testblockz.lvol" } )
+        {
+          LImage read = LongvolReader<LImage>::importLongvol(name);
+          REQUIRE( checkImage(limage, read) );
+          LMapImage readMap = LongvolReader<LMapImage, DoubleFunctor>::importLongvol(name);
+          bool ok = true;
+          for(auto p: ldomain)
+            ok = ok && readMap(p) == 2 * limage(p) + 1;
+          REQUIRE( ok );
+        }
+    }
+}
+
+TEST_CASE( "Testing chunked VolWriter and LongvolWriter" )
+{
+  Domain domain(Point(-3,0,2), Point(57,49,42));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLMap<Domain, int> MapImage;
+  Image image(domain);
+  srand( 1 );
+  for(auto & v: image) v = static_cast<unsigned char>( rand() % 8 );
+  ThreadPool pool( 4 );
+  // Blocks of 10000 voxels: the last block is shorter.
+  VolWriter<Image>::exportChunkedVol("testchunked.vol", image, functors::Identity(), 10000);
+  VolWriter<Image>::exportChunkedVol("testchunkedp.vol", image, functors::Identity(), 10000, &pool);
+
+  SECTION("Chunked Vol import, sequential or in parallel")
+    {
+      std::ifstream a("testchunked.vol", std::ios::binary), b("testchunkedp.vol", std::ios::binary);
+      std::string ca( (std::istreambuf_iterator<char>(a)), std::istreambuf_iterator<char>() );
+      std::string cb( (std::istreambuf_iterator<char>(b)), std::istreambuf_iterator<char>() );
+      REQUIRE( ca == cb );
+      REQUIRE( ca.find( "Version: 4\n" ) != std::string::npos );
+
+      REQUIRE( checkImage( image, VolReader<Image>::importVol("testchunked.vol") ) );
+      REQUIRE( checkImage( image, VolReader<Image>::importVol("testchunked.vol", functors::Cast<unsigned char>(), &pool) ) );
+      MapImage readMap = VolReader<MapImage, DoubleFunctor>::importVol("testchunked.vol", DoubleFunctor(), &pool);
+      bool ok = true;
+      for(auto p: domain)
+        ok = ok && readMap(p) == 2 * int( image(p) ) + 1;
+      REQUIRE( ok );
+    }
+
+  SECTION("Selective decompression of chunked Vol files")
+    {
+      VolStreamReader<Image> reader("testchunked.vol");
+      REQUIRE( reader.isCompressed() );
+      Domain sub(Point(10,20,30), Point(40,30,35));
+      Image part = reader.readSubDomain( sub );
+      Image slab = reader.readSlab( 3, 4 );
+      Image part2 = reader.readSubDomain( sub );
+      bool ok = true;
+      for(auto p: sub) ok = ok && part(p) == image(p) && part2(p) == image(p);
+      for(auto p: slab.domain()) ok = ok && slab(p) == image(p);
+      REQUIRE( ok );
+    }
+
+  SECTION("Truncated chunked Vol files are rejected")
+    {
+      std::ifstream in("testchunked.vol", std::ios::binary);
+      std::string content( (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>() );
+      std::ofstream out("testchunkedtruncated.vol", std::ios::binary);
+      out.write( content.data(), std::streamsize( content.size() - 10 ) );
+      out.close();
+      REQUIRE_THROWS_AS( VolReader<Image>::importVol("testchunkedtruncated.vol"), IOException );
+      REQUIRE_THROWS_AS( VolReader<Image>::importVol("testchunkedtruncated.vol", functors::Cast<unsigned char>(), &pool),
+                         IOException );
+      VolStreamReader<Image> reader("testchunkedtruncated.vol");
+      REQUIRE( reader.readSlab( 2, 3 ).domain().size() == 2 * 61 * 50 );
+      REQUIRE_THROWS_AS( reader.readSlab( 42, 42 ), IOException );
+    }
+
+  SECTION("Invalid block sizes are rejected")
+    {
+      typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LImage;
+      LImage limage(domain);
+      const std::size_t tooLarge = std::size_t( std::numeric_limits<int>::max() ) + 1;
+      REQUIRE_THROWS_AS( VolWriter<Image>::exportChunkedVol("testchunkedinvalid.vol", image,
+                                                            functors::Identity(), 0),
+                         IOException );
+      REQUIRE_THROWS_AS( VolWriter<Image>::exportChunkedVol("testchunkedinvalid.vol", image,
+                                                            functors::Identity(), tooLarge),
+                         IOException );
+      REQUIRE_THROWS_AS( LongvolWriter<LImage>::exportChunkedLongvol("testchunkedinvalid.lvol", limage,
+                                                                     functors::Identity(), 0),
+                         IOException );
+      REQUIRE_THROWS_AS( LongvolWriter<LImage>::exportChunkedLongvol("testchunkedinvalid.lvol", limage,
+                                                                     functors::Identity(), tooLarge),
+                         IOException );
+    }
+
+  SECTION("Chunked Longvol import, sequential or in parallel")
+    {
+      typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LImage;
+      typedef ImageContainerBySTLMap<Domain, DGtal::uint64_t> LMapImage;
+      LImage limage(domain);
+      for(auto & v: limage)
+        v = ( DGtal::uint64_t( rand() ) << 40 ) ^ DGtal::uint64_t( rand() );
+      LongvolWriter<LImage>::exportChunkedLongvol("testchunked.lvol", limage, functors::Identity(), 3000, &pool);
+      REQUIRE( checkImage( limage, LongvolReader<LImage>::importLongvol("testchunked.lvol") ) );
+      REQUIRE( checkImage( limage, LongvolReader<LImage>::importLongvol("testchunked.lvol",
+                                                                          functors::Cast<DGtal::uint64_t>(), &pool) ) );
+      LMapImage readMap = LongvolReader<LMapImage, DoubleFunctor>::importLongvol("testchunked.lvol");
+      bool ok = true;
+      for(auto p: domain)
+        ok = ok && readMap(p) == 2 * limage(p) + 1;
+      REQUIRE( ok );
+      VolStreamReader<LImage, DGtal::uint64_t> reader("testchunked.lvol");
+      LImage slab = reader.readSlab( 20, 21 );
+      for(auto p: slab.domain()) ok = ok && slab(p) == limage(p);
+      REQUIRE( ok );
+    }
+}
+
 /** @ingroup Tests **/
@@ -38,6 +38,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 
@@ -54,10 +55,12 @@ using namespace DGtal;
 typedef DGtal::DigitalSetBySTLSet< Z2i::Domain> FromSet;
 typedef DGtal::DigitalSetBySTLVector< Z2i::Domain> FromVector;
 typedef DGtal::DigitalSetByAssociativeContainer< Z2i::Domain, std::unordered_set<Z2i::Point> > FromUnordered;
+typedef DGtal::DigitalSetByBitset< Z2i::Domain> FromBitset;
 
 typedef DGtal::DigitalSetBySTLSet< Z3i::Domain> FromSet3;
 typedef DGtal::DigitalSetBySTLVector< Z3i::Domain> FromVector3;
 typedef DGtal::DigitalSetByAssociativeContainer< Z3i::Domain, std::unordered_set<Z3i::Point> > FromUnordered3;
+typedef DGtal::DigitalSetByBitset< Z3i::Domain> FromBitset3;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -74,9 +77,11 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitset)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered3)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitset3)->Range(1<<3 , 1 << 8);
 
 
 template<typename Q>
@@ -97,6 +102,7 @@ static void BM_insert(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_insert, FromVector);
 BENCHMARK_TEMPLATE(BM_insert, FromSet);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered);
+BENCHMARK_TEMPLATE(BM_insert, FromBitset);
 BENCHMARK_TEMPLATE(BM_insert, FromVector3);
 BENCHMARK_TEMPLATE(BM_insert, FromSet3);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered3);
@@ -124,11 +130,102 @@ static void BM_iterate(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_iterate, FromVector)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered)->Range(1<<3 , 1 << 10);;
+BENCHMARK_TEMPLATE(BM_iterate, FromBitset)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromVector3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered3)->Range(1<<3 , 1 << 10);;
 
 
+// Dense sets (one point out of two) in a domain of size range(0)^3,
+// the use case of WHOLE_DS sets.
+template<typename Q>
+static void fillDense( Q & myset, unsigned int seed )
+{
+  srand( seed );
+  for ( typename Q::Domain::ConstIterator it = myset.domain().begin(),
+          itend = myset.domain().end(); it != itend; ++it )
+    if ( rand() % 2 )
+      myset.insertNew( *it );
+}
+
+template<typename Q>
+static void BM_denseMembership(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal(state.range(0)-1) );
+  Q myset( dom );
+  fillDense( myset, 0 );
+  while (state.KeepRunning())
+    {
+      unsigned int nb = 0;
+      for(typename Q::Domain::ConstIterator it = dom.begin(), itend = dom.end();
+          it != itend; ++it)
+        nb += myset( *it ) ? 1 : 0;
+      benchmark::DoNotOptimize(nb);
+    }
+  state.SetItemsProcessed( state.iterations() * dom.size() );
+}
+BENCHMARK_TEMPLATE(BM_denseMembership, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseMembership, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseMembership, FromBitset3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseIterate(benchmark::State& state)
+{
+  Q myset( typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(state.range(0)-1) ) );
+  fillDense( myset, 0 );
+  while (state.KeepRunning())
+    {
+      for(typename Q::ConstIterator it= myset.begin(), itend=myset.end(); it != itend;
+          ++it)
+        benchmark::DoNotOptimize(*it);
+    }
+  state.SetItemsProcessed( state.iterations() * myset.size() );
+}
+BENCHMARK_TEMPLATE(BM_denseIterate, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromBitset3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseUnion(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal(state.range(0)-1) );
+  Q a( dom ), b( dom );
+  fillDense( a, 0 );
+  fillDense( b, 1 );
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Q c( a );
+      state.ResumeTiming();
+      c += b;
+      benchmark::DoNotOptimize(c.size());
+    }
+  state.SetItemsProcessed( state.iterations() * dom.size() );
+}
+BENCHMARK_TEMPLATE(BM_denseUnion, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromBitset3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseIntersection(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal(state.range(0)-1) );
+  Q a( dom ), b( dom );
+  fillDense( a, 0 );
+  fillDense( b, 1 );
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Q c( a );
+      state.ResumeTiming();
+      c *= b;
+      benchmark::DoNotOptimize(c.size());
+    }
+  state.SetItemsProcessed( state.iterations() * dom.size() );
+}
+BENCHMARK_TEMPLATE(BM_denseIntersection, FromBitset3)->Range(1<<4 , 1 << 7);
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -52,6 +52,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -367,6 +368,96 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetByBitset()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Bitset set operations against std::set" );
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitset< Domain > BitSet;
+  typedef DigitalSetBySTLSet< Domain > RefSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< BitSet > ));
+  // 70x3x5 points, the last word is partially used.
+  Domain domain( Point( -3, 2, -1 ), Point( 66, 4, 3 ) );
+  BitSet A( domain ), B( domain );
+  RefSet RA( domain ), RB( domain );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 400; ++i )
+    {
+      Point p( -3 + rand() % 70, 2 + rand() % 3, -1 + rand() % 5 );
+      Point q( -3 + rand() % 70, 2 + rand() % 3, -1 + rand() % 5 );
+      A.insert( p ); RA.insert( p );
+      B.insert( q ); RB.insert( q );
+    }
+  std::vector< Point > vA( A.begin(), A.end() );
+  std::vector< Point > vRA( RA.begin(), RA.end() );
+  std::sort( vA.begin(), vA.end() );
+  INBLOCK_TEST( A.size() == RA.size() && vA == vRA && A.isValid() );
+  bool in_domain_order = true;
+  for ( BitSet::ConstIterator it = A.begin(), prev = it++; it != A.end(); prev = it++ )
+    in_domain_order = in_domain_order && ( prev.index() < it.index() );
+  INBLOCK_TEST( in_domain_order );
+  bool found = true;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    found = found && ( A( *it ) == RA( *it ) )
+      && ( ( A.find( *it ) != A.end() ) == A( *it ) )
+      && ( ! A( *it ) || *A.find( *it ) == *it );
+  INBLOCK_TEST( found );
+  INBLOCK_TEST( ! A( Point( 67, 2, 0 ) ) && A.erase( Point( 67, 2, 0 ) ) == 0 );
+
+  BitSet U( A ), I( A ), D( A ), C( domain );
+  U += B; I *= B; D -= B;
+  C.assignFromComplement( A );
+  std::size_t nbU = 0, nbI = 0, nbD = 0;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const bool a = RA( *it ), b = RB( *it );
+      nbU += ( U( *it ) == ( a || b ) ) ? 1 : 0;
+      nbI += ( I( *it ) == ( a && b ) ) ? 1 : 0;
+      nbD += ( D( *it ) == ( a && ! b ) ) ? 1 : 0;
+    }
+  INBLOCK_TEST2( nbU == domain.size() && U.isValid(), "Union " << U );
+  INBLOCK_TEST2( nbI == domain.size() && I.isValid(), "Intersection " << I );
+  INBLOCK_TEST2( nbD == domain.size() && D.isValid(), "Difference " << D );
+  INBLOCK_TEST2( C.size() + A.size() == domain.size() && C.isValid()
+                 && ( C *= A ).empty(), "Complement" );
+  INBLOCK_TEST( U.size() + I.size() == A.size() + B.size() );
+
+  // Operations between sets of different domains.
+  Domain small( Point( 0, 2, 0 ), Point( 10, 4, 2 ) );
+  BitSet S( small );
+  for ( Domain::ConstIterator it = small.begin(); it != small.end(); ++it )
+    if ( RB( *it ) ) S.insert( *it );
+  BitSet AS( A ), DS( A );
+  AS += S; DS -= S;
+  std::size_t nbAS = 0, nbDS = 0;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const bool a = RA( *it ), b = S( *it );
+      nbAS += ( AS( *it ) == ( a || b ) ) ? 1 : 0;
+      nbDS += ( DS( *it ) == ( a && ! b ) ) ? 1 : 0;
+    }
+  INBLOCK_TEST( nbAS == domain.size() && nbDS == domain.size()
+                && AS.isValid() && DS.isValid() );
+  Point lower, upper, rlower, rupper;
+  A.computeBoundingBox( lower, upper );
+  RA.computeBoundingBox( rlower, rupper );
+  INBLOCK_TEST( lower == rlower && upper == rupper );
+
+  std::vector< Point > removed( A.begin(), A.end() );
+  A.erase( A.begin(), A.end() );
+  INBLOCK_TEST( A.empty() && A.begin() == A.end() && A.isValid()
+                && removed.size() == RA.size() );
+
+  typedef DigitalSetSelector< Domain, WHOLE_DS + HIGH_BEL_DS >::Type WholeSet;
+  INBLOCK_TEST( ( std::is_same< WholeSet, BitSet >::value ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<Z2i::DigitalSet> ));
@@ -428,6 +519,13 @@ int main()
   ( DigitalSetByAssociativeContainer<Domain, ContainerU>(domain), DigitalSetByAssociativeContainer<Domain, ContainerU>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitset" );
+  bool okBitset = testDigitalSet< DigitalSetByBitset<Domain> >
+  ( DigitalSetByBitset<Domain>(domain), DigitalSetByBitset<Domain>(domain) );
+  trace.endBlock();
+
+  bool okBitsetOperations = testDigitalSetByBitset();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -440,6 +538,10 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorWhole = testDigitalSetSelector
+      < Domain, WHOLE_DS + LOW_VAR_DS + HIGH_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Whole set" );
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
@@ -449,7 +551,8 @@ int main()
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
-     && okUnorderedSet && okAssoctestSet;
+     && okUnorderedSet && okAssoctestSet
+     && okBitset && okBitsetOperations && okSelectorWhole;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of CubicalComplex with a DenseCellMap against std::map
+ * and std::unordered_map cell containers.
+ *
+ * Usage: testDenseCellMap-benchmark [size]
+ * (default: a ball of diameter size/4 in a 256^3 domain).
+ * The closure of the voxels of the ball and its collapse are timed
+ * with the three containers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/DenseCellMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3, DGtal::int32_t> KSpace;
+typedef KSpace::Point                       Point;
+typedef KSpace::Cell                        Cell;
+typedef KSpace::Integer                     Integer;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Builds the complex made of the voxels of a ball and closes it,
+ * then collapses it onto its central vertex.
+ *
+ * @param name the name of the container, for display.
+ * @param K the Khalimsky space.
+ * @param nbCells (returns) the number of cells of each dimension of
+ * the closed complex, then of the collapsed complex.
+ */
+template <typename TCellContainer>
+void benchmark( const std::string & name, const KSpace & K,
+                std::vector<std::size_t> & nbCells )
+{
+  typedef CubicalComplex< KSpace, TCellContainer > CC;
+  const Integer r = K.size( 0 ) / 8;
+  trace.beginBlock( name );
+  Clock c;
+  c.startClock();
+  CC complex( K );
+  std::vector<Cell> S;
+  for ( Integer x = -r; x <= r; ++x )
+    for ( Integer y = -r; y <= r; ++y )
+      for ( Integer z = -r; z <= r; ++z )
+        if ( x*x + y*y + z*z <= r*r )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            complex.insertCell( 3, S.back() );
+          }
+  complex.close();
+  const double t1 = c.stopClock();
+  nbCells.clear();
+  for ( Dimension d = 0; d <= 3; ++d )
+    nbCells.push_back( complex.nbCells( d ) );
+  trace.info() << "Closure: " << nbCells[ 0 ] << " vertices, "
+               << nbCells[ 1 ] << " edges, " << nbCells[ 2 ] << " faces, "
+               << nbCells[ 3 ] << " voxels in " << t1 << " ms" << std::endl;
+
+  c.startClock();
+  complex.findCell( 0, K.uPointel( Point( 0, 0, 0 ) ) )->second.data |= CC::FIXED;
+  typename CC::DefaultCellMapIteratorPriority P;
+  functions::collapse( complex, S.begin(), S.end(), P, false, true );
+  const double t2 = c.stopClock();
+  for ( Dimension d = 0; d <= 3; ++d )
+    nbCells.push_back( complex.nbCells( d ) );
+  trace.info() << "Collapse: " << complex.size() << " cells left in "
+               << t2 << " ms" << std::endl;
+  trace.endBlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking DenseCellMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int half = ( argc > 1 ? atoi( argv[ 1 ] ) : 256 ) / 2;
+  KSpace K;
+  K.init( Point::diagonal( -half ), Point::diagonal( half - 1 ), true );
+  std::vector<std::size_t> nb1, nb2, nb3;
+  benchmark< std::map< Cell, CubicalCellData > >
+    ( "std::map", K, nb1 );
+  benchmark< std::unordered_map< Cell, CubicalCellData > >
+    ( "std::unordered_map", K, nb2 );
+  benchmark< DenseCellMap< KSpace, CubicalCellData > >
+    ( "DenseCellMap", K, nb3 );
+  bool res = ( nb1 == nb3 ) && ( nb2 == nb3 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DenseCellMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/DenseCellMap.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseCellMap.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef KhalimskySpaceND<3>                       KSpace;
+typedef KSpace::Point                             Point;
+typedef KSpace::Cell                              Cell;
+typedef KSpace::Integer                           Integer;
+typedef DenseCellMap< KSpace, CubicalCellData >   DenseMap;
+typedef std::map< Cell, CubicalCellData >         TreeMap;
+typedef CubicalComplex< KSpace, DenseMap >        DenseCC;
+typedef CubicalComplex< KSpace, TreeMap >         TreeCC;
+
+/// Fills both complexes with the same random voxels of a ball.
+template <typename CC1, typename CC2>
+void randomBall( const KSpace & K, CC1 & X1, CC2 & X2, std::vector<Cell> & S )
+{
+  for ( Integer x = -6; x <= 6; ++x )
+    for ( Integer y = -6; y <= 6; ++y )
+      for ( Integer z = -6; z <= 6; ++z )
+        if ( x*x + y*y + z*z <= 36 && rand() % 4 != 0 )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            X1.insertCell( S.back() );
+            X2.insertCell( S.back() );
+          }
+}
+
+/// Checks that both complexes have the same cells and data.
+template <typename CC1, typename CC2>
+void checkSameComplexes( const CC1 & X1, const CC2 & X2 )
+{
+  for ( Dimension d = 0; d <= 3; ++d )
+    {
+      REQUIRE( X1.nbCells( d ) == X2.nbCells( d ) );
+      for ( auto it = X2.begin( d ), itE = X2.end( d ); it != itE; ++it )
+        {
+          auto it1 = X1.findCell( d, it->first );
+          REQUIRE( it1 != X1.end( d ) );
+          REQUIRE( it1->second.data == it->second.data );
+        }
+    }
+}
+
+TEST_CASE( "Testing DenseCellMap" )
+{
+  srand( 0 );
+  KSpace K;
+  REQUIRE( K.init( Point( -10, -8, -9 ), Point( 10, 11, 9 ), true ) );
+
+  SECTION( "Concepts and storage" )
+    {
+      BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< DenseMap > ));
+      BOOST_STATIC_ASSERT(( IsPairAssociativeContainer< DenseMap >::value ));
+      BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< DenseMap >::value ));
+      DenseMap M0( K, 0 ), M1( K, 1 ), M2( K, 2 ), M3( K, 3 );
+      REQUIRE( M0.isValid() );
+      REQUIRE( M0.max_size() == 22 * 21 * 20 );
+      REQUIRE( M3.max_size() == 21 * 20 * 19 );
+      // Closed spaces: the maps of a complex cover the Khalimsky grid.
+      REQUIRE( M0.max_size() + M1.max_size() + M2.max_size() + M3.max_size()
+               == 43 * 41 * 39 );
+      REQUIRE( ! DenseMap().isValid() );
+    }
+
+  SECTION( "Insertions, queries and deletions behave as std::map" )
+    {
+      DenseMap M( K, 1 );
+      TreeMap  T;
+      for ( int n = 0; n < 5000; ++n )
+        {
+          Point p;
+          for ( Dimension k = 0; k < 3; ++k )
+            p[ k ] = K.uKCoord( K.lowerCell(), k )
+              + rand() % ( K.uKCoord( K.upperCell(), k ) - K.uKCoord( K.lowerCell(), k ) + 1 );
+          const Cell c = K.uCell( p );
+          if ( K.uDim( c ) != 1 )
+            {
+              REQUIRE( M.find( c ) == M.end() );
+              continue;
+            }
+          const int op = rand() % 3;
+          if ( op == 0 )
+            REQUIRE( M.erase( c ) == T.erase( c ) );
+          else if ( op == 1 )
+            {
+              const DGtal::uint32_t v = rand();
+              REQUIRE( M.insert( std::make_pair( c, CubicalCellData( v ) ) ).second
+                       == T.insert( std::make_pair( c, CubicalCellData( v ) ) ).second );
+            }
+          else
+            M[ c ].data = T[ c ].data = rand();
+          REQUIRE( M.size() == T.size() );
+          REQUIRE( M.count( c ) == T.count( c ) );
+        }
+      std::size_t nb = 0;
+      for ( DenseMap::const_iterator it = M.begin(), itE = M.end(); it != itE; ++it, ++nb )
+        {
+          TreeMap::const_iterator itT = T.find( it->first );
+          REQUIRE( itT != T.end() );
+          REQUIRE( it->second.data == itT->second.data );
+        }
+      REQUIRE( nb == T.size() );
+      // Erasing while iterating.
+      for ( DenseMap::iterator it = M.begin(); it != M.end(); )
+        if ( it->second.data % 2 == 0 )
+          {
+            T.erase( it->first );
+            it = M.erase( it );
+          }
+        else ++it;
+      REQUIRE( M.size() == T.size() );
+      M.clear();
+      REQUIRE( M.empty() );
+      REQUIRE( M.begin() == M.end() );
+      // Cells outside of the map range are rejected.
+      REQUIRE_THROWS_AS( M[ K.uPointel( Point( 0, 0, 0 ) ) ], InputException );
+      KSpace K2;
+      REQUIRE( K2.init( Point::diagonal( -20 ), Point::diagonal( 20 ), true ) );
+      REQUIRE_THROWS_AS( M[ K2.uCell( Point( 31, 0, 0 ) ) ], InputException );
+      REQUIRE( M.empty() );
+    }
+
+  SECTION( "Closure of a complex is the same as with std::map" )
+    {
+      DenseCC X1( K );
+      TreeCC  X2( K );
+      std::vector<Cell> S;
+      randomBall( K, X1, X2, S );
+      X1.close();
+      X2.close();
+      checkSameComplexes( X1, X2 );
+      REQUIRE( X1.euler() == X2.euler() );
+    }
+
+  SECTION( "Collapse of a complex is the same as with std::map" )
+    {
+      DenseCC X1( K );
+      TreeCC  X2( K );
+      std::vector<Cell> S;
+      for ( Integer x = 0; x < 3; ++x )
+        for ( Integer y = 0; y < 3; ++y )
+          for ( Integer z = 0; z < 3; ++z )
+            {
+              S.push_back( K.uSpel( Point( x, y, z ) ) );
+              X1.insertCell( S.back() );
+              X2.insertCell( S.back() );
+            }
+      X1.close();
+      X2.close();
+      X1.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) )->second.data |= DenseCC::FIXED;
+      X2.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) )->second.data |= TreeCC::FIXED;
+      X1.findCell( 0, K.uCell( Point( 6, 6, 6 ) ) )->second.data |= DenseCC::FIXED;
+      X2.findCell( 0, K.uCell( Point( 6, 6, 6 ) ) )->second.data |= TreeCC::FIXED;
+      DenseCC::DefaultCellMapIteratorPriority P1;
+      TreeCC::DefaultCellMapIteratorPriority  P2;
+      const auto n1 = functions::collapse( X1, S.begin(), S.end(), P1, false, true );
+      const auto n2 = functions::collapse( X2, S.begin(), S.end(), P2, false, true );
+      REQUIRE( n1 == n2 );
+      REQUIRE( X1.euler() == 1 );
+      REQUIRE( X1.nbCells( 3 ) == 0 );
+      REQUIRE( X1.nbCells( 2 ) == 0 );
+      REQUIRE( X1.nbCells( 0 ) == X2.nbCells( 0 ) );
+      REQUIRE( X1.nbCells( 1 ) == X2.nbCells( 1 ) );
+    }
+
+  SECTION( "Set operations on complexes" )
+    {
+      DenseCC A1( K ), B1( K );
+      TreeCC  A2( K ), B2( K );
+      std::vector<Cell> S;
+      randomBall( K, A1, A2, S );
+      randomBall( K, B1, B2, S );
+      A1.close(); A2.close();
+      B1.close(); B2.close();
+      checkSameComplexes( A1 | B1, A2 | B2 );
+      checkSameComplexes( A1 & B1, A2 & B2 );
+      checkSameComplexes( A1 - B1, A2 - B2 );
+      checkSameComplexes( A1 ^ B1, A2 ^ B2 );
+      REQUIRE( ( ( A1 & B1 ) <= A1 ) );
+      DenseCC C1( A1 );
+      C1 -= B1;
+      checkSameComplexes( C1, A2 - B2 );
+      checkSameComplexes( ~A1, ~A2 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -638,4 +638,63 @@ SCENARIO( "HalfEdgeDataStructure merges", "[halfedge][merges]" ){
   }
 }
 
+SCENARIO( "HalfEdgeDataStructure build from flat faces", "[halfedge][build]" ){
+  auto flatBuild = [] ( const std::vector< PolygonalFace >& faces,
+                        HalfEdgeDataStructure& mesh )
+    {
+      std::vector< HalfEdgeDataStructure::Index > offsets( 1, 0 );
+      std::vector< HalfEdgeDataStructure::VertexIndex > vertices;
+      for ( const auto& f : faces )
+        {
+          vertices.insert( vertices.end(), f.begin(), f.end() );
+          offsets.push_back( vertices.size() );
+        }
+      return mesh.buildFromFlatFaces( offsets, vertices );
+    };
+  auto sameMesh = [] ( const HalfEdgeDataStructure& M1,
+                       const HalfEdgeDataStructure& M2 )
+    {
+      bool ok = M1.nbVertices() == M2.nbVertices() && M1.nbEdges() == M2.nbEdges()
+        && M1.nbFaces() == M2.nbFaces() && M1.nbHalfEdges() == M2.nbHalfEdges();
+      for ( HalfEdgeDataStructure::Index i = 0; ok && i < M1.nbHalfEdges(); ++i )
+        {
+          const auto& he1 = M1.halfEdge( i );
+          const auto& he2 = M2.halfEdge( i );
+          ok = he1.toVertex == he2.toVertex && he1.face == he2.face
+            && he1.edge == he2.edge && he1.opposite == he2.opposite
+            && he1.next == he2.next
+            && M2.findHalfEdgeIndexFromArc( M1.halfEdge( he1.opposite ).toVertex,
+                                            he1.toVertex ) == i;
+        }
+      for ( HalfEdgeDataStructure::Index v = 0; ok && v < M1.nbVertices(); ++v )
+        ok = M1.halfEdgeIndexFromVertexIndex( v ) == M2.halfEdgeIndexFromVertexIndex( v );
+      for ( HalfEdgeDataStructure::Index f = 0; ok && f < M1.nbFaces(); ++f )
+        ok = M1.halfEdgeIndexFromFaceIndex( f ) == M2.halfEdgeIndexFromFaceIndex( f );
+      return ok;
+    };
+  std::vector< std::vector< PolygonalFace > > meshes = {
+    { { 0, 3, 2, 1 }, { 0, 1, 4 }, { 1, 2, 4 }, { 2, 3, 4 }, { 3, 0, 4 } },
+    { { 1, 0, 2, 3 }, { 0, 1, 5, 4 }, { 1, 3, 7, 5 }, { 3, 2, 6, 7 },
+      { 2, 0, 4, 6 }, { 4, 5, 8, 9 } },
+    { { 0, 1, 2 }, { 2, 1, 3 }, { 2, 3, 4 }, { 4, 3, 5 }, { 4, 5, 0 }, { 0, 5, 1 } } };
+  GIVEN( "A pyramid, a box with an open side and a ribbon with a hole" ) {
+    THEN( "The flat build gives the same half-edges as build" ) {
+      for ( const auto& faces : meshes )
+        {
+          HalfEdgeDataStructure M1, M2;
+          REQUIRE( M1.build( faces ) );
+          REQUIRE( flatBuild( faces, M2 ) );
+          REQUIRE( sameMesh( M1, M2 ) );
+        }
+    }
+  }
+  GIVEN( "Three triangles sharing an arc" ) {
+    std::vector< PolygonalFace > faces = { { 0, 1, 2 }, { 1, 0, 3 }, { 0, 1, 4 } };
+    HalfEdgeDataStructure mesh;
+    THEN( "The flat build fails" ) {
+      REQUIRE( ! flatBuild( faces, mesh ) );
+    }
+  }
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,137 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the cell containers of HashedKhalimskySpaceND against
+ * the ones of KhalimskySpaceND.
+ *
+ * Usage: testHashedKhalimskySpaceND-benchmark [size]
+ * (default: an ellipsoid in a 256^3 domain, use 512 for a 512^3 domain).
+ * Boundary tracking of the ellipsoid and closure of its surface as a
+ * CubicalComplex are timed with both spaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TPoint>
+struct ImplicitDigitalEllipse3 {
+  typedef TPoint Point;
+  ImplicitDigitalEllipse3( double a, double b, double c )
+    : myA( a ), myB( b ), myC( c )
+  {}
+  bool operator()( const TPoint & p ) const
+  {
+    double x = ( (double) p[ 0 ] / myA );
+    double y = ( (double) p[ 1 ] / myB );
+    double z = ( (double) p[ 2 ] / myC );
+    return ( x*x + y*y + z*z ) <= 1.0;
+  }
+  double myA, myB, myC;
+};
+
+/**
+ * Tracks the boundary of the ellipsoid in the space @a TKSpace, then
+ * builds and closes the cubical complex made of its surfels.
+ *
+ * @param name the name of the space, for display.
+ * @param size the side of the cubic domain.
+ * @param nbCells (returns) the number of cells of each dimension of the complex.
+ * @return the number of tracked surfels.
+ */
+template <typename TKSpace>
+std::size_t benchmark( const std::string & name, int size,
+                       std::vector<std::size_t> & nbCells )
+{
+  typedef typename TKSpace::Point Point;
+  typedef ImplicitDigitalEllipse3<Point> Ellipse;
+  const int half = size / 2;
+  TKSpace K;
+  K.init( Point::diagonal( -half ), Point::diagonal( half ), true );
+  Ellipse ellipse( 0.9 * half, 0.7 * half, 0.5 * half );
+  trace.beginBlock( name );
+  typename TKSpace::SCell bel = Surfaces<TKSpace>::findABel( K, ellipse, 100000 );
+
+  Clock c;
+  c.startClock();
+  typename TKSpace::SCellSet surface;
+  Surfaces<TKSpace>::trackBoundary( surface, K, SurfelAdjacency<3>( true ), ellipse, bel );
+  const double t1 = c.stopClock();
+  trace.info() << "Surface tracking: " << surface.size() << " surfels in "
+               << t1 << " ms" << std::endl;
+
+  c.startClock();
+  CubicalComplex<TKSpace> complex( K );
+  for ( auto&& s : surface )
+    complex.insertCell( K.unsigns( s ) );
+  complex.close();
+  const double t2 = c.stopClock();
+  nbCells.clear();
+  for ( Dimension d = 0; d <= 2; ++d )
+    nbCells.push_back( complex.nbCells( d ) );
+  trace.info() << "CubicalComplex closure: " << nbCells[ 0 ] << " vertices, "
+               << nbCells[ 1 ] << " edges, " << nbCells[ 2 ] << " faces in "
+               << t2 << " ms" << std::endl;
+  trace.endBlock();
+  return surface.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking HashedKhalimskySpaceND" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 256;
+  std::vector<std::size_t> nb1, nb2;
+  const std::size_t n1 = benchmark< KhalimskySpaceND<3, DGtal::int32_t> >
+    ( "KhalimskySpaceND (std::set / std::map)", size, nb1 );
+  const std::size_t n2 = benchmark< HashedKhalimskySpaceND<3, DGtal::int32_t> >
+    ( "HashedKhalimskySpaceND (std::unordered_set / std::unordered_map)", size, nb2 );
+  bool res = ( n1 == n2 ) && ( nb1 == nb2 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class HashedKhalimskySpaceND.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HashedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace {
+  template <typename TPoint>
+  struct ImplicitDigitalEllipse3 {
+    typedef TPoint Point;
+    ImplicitDigitalEllipse3( double a, double b, double c )
+      : myA( a ), myB( b ), myC( c )
+    {}
+    bool operator()( const TPoint & p ) const
+    {
+      double x = ( (double) p[ 0 ] / myA );
+      double y = ( (double) p[ 1 ] / myB );
+      double z = ( (double) p[ 2 ] / myC );
+      return ( x*x + y*y + z*z ) <= 1.0;
+    }
+    double myA, myB, myC;
+  };
+}
+
+TEST_CASE( "Testing HashedKhalimskySpaceND" )
+{
+  typedef KhalimskySpaceND< 3, DGtal::int32_t >       KSpace;
+  typedef HashedKhalimskySpaceND< 3, DGtal::int32_t > HKSpace;
+  typedef KSpace::Point                               Point;
+  typedef KSpace::SCell                               SCell;
+  typedef ImplicitDigitalEllipse3< Point >            Ellipse;
+  BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< HKSpace > ));
+  BOOST_STATIC_ASSERT(( std::is_same< HKSpace::SCellSet, std::unordered_set< SCell > >::value ));
+  BOOST_STATIC_ASSERT(( std::is_same< HKSpace::CellMap<int>::Type,
+                        std::unordered_map< KSpace::Cell, int > >::value ));
+
+  KSpace K;
+  REQUIRE( K.init( Point( -20, -20, -20 ), Point( 20, 20, 20 ), true ) );
+  HKSpace HK( K );
+  REQUIRE( HK.lowerBound() == K.lowerBound() );
+  REQUIRE( HK.upperBound() == K.upperBound() );
+  HKSpace HK2;
+  REQUIRE( HK2.init( Point( -20, -20, -20 ), Point( 20, 20, 20 ), true ) );
+  REQUIRE( HK2.upperCell() == K.upperCell() );
+
+  Ellipse ellipse( 15.0, 11.0, 8.0 );
+  SurfelAdjacency< 3 > adj( true );
+  SCell bel = Surfaces< KSpace >::findABel( K, ellipse, 10000 );
+
+  SECTION( "Boundary tracking gives the same surfels" )
+    {
+      KSpace::SCellSet  ordered;
+      HKSpace::SCellSet hashed;
+      Surfaces< KSpace >::trackBoundary( ordered, K, adj, ellipse, bel );
+      Surfaces< HKSpace >::trackBoundary( hashed, HK, adj, ellipse, bel );
+      REQUIRE( ordered.size() == hashed.size() );
+      for ( auto&& s : hashed )
+        REQUIRE( ordered.count( s ) == 1 );
+    }
+
+  SECTION( "Digital surfaces have the same number of surfels" )
+    {
+      ImplicitDigitalSurface< KSpace, Ellipse >  S1( K, ellipse, adj, bel );
+      ImplicitDigitalSurface< HKSpace, Ellipse > S2( HK, ellipse, adj, bel );
+      REQUIRE( std::distance( S1.begin(), S1.end() ) == std::distance( S2.begin(), S2.end() ) );
+      for ( auto&& s : S2 )
+        REQUIRE( S1.isInside( s ) );
+    }
+
+  SECTION( "CubicalComplex closures are identical" )
+    {
+      CubicalComplex< KSpace >  C1( K );
+      CubicalComplex< HKSpace > C2( HK );
+      for ( Point p = K.lowerBound(); p[ 2 ] <= K.upperBound()[ 2 ]; ++p[ 2 ] )
+        for ( p[ 1 ] = K.lowerBound()[ 1 ]; p[ 1 ] <= K.upperBound()[ 1 ]; ++p[ 1 ] )
+          for ( p[ 0 ] = K.lowerBound()[ 0 ]; p[ 0 ] <= K.upperBound()[ 0 ]; ++p[ 0 ] )
+            if ( ellipse( p ) )
+              {
+                C1.insertCell( K.uSpel( p ) );
+                C2.insertCell( HK.uSpel( p ) );
+              }
+      C1.close();
+      C2.close();
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( C1.nbCells( d ) == C2.nbCells( d ) );
+      REQUIRE( C2.euler() == 1 );
+      for ( auto&& c : C1.getCells( 1 ) )
+        REQUIRE( C2.belongs( c.first ) );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,124 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the construction of IndexedDigitalSurface, through a
+ * DigitalSurface and directly from sorted surfels.
+ *
+ * Usage: testIndexedDigitalSurface-benchmark [radius] [maxThreads]
+ * (default: the boundary of a ball of radius 64, up to the number of
+ * hardware threads). A radius of 1000 gives about 10^7 surfels.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <thread>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace                                  KSpace;
+typedef Z3i::Point                                   Point;
+typedef KSpace::SCell                                SCell;
+typedef SetOfSurfels< KSpace, std::set< SCell > >    Container;
+typedef IndexedDigitalSurface< Container >           DigSurface;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/// The characteristic function of a ball centered at the origin.
+struct Ball
+{
+  typedef Z3i::Point Point;
+  long long r2;
+  bool operator()( const Point & p ) const
+  { return (long long) p[ 0 ] * p[ 0 ] + (long long) p[ 1 ] * p[ 1 ]
+      + (long long) p[ 2 ] * p[ 2 ] <= r2; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking IndexedDigitalSurface construction" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int radius = argc > 1 ? atoi( argv[ 1 ] ) : 64;
+  const unsigned int maxThreads = argc > 2 ? (unsigned int) atoi( argv[ 2 ] )
+    : std::max( 1u, std::thread::hardware_concurrency() );
+  const Point lo = Point::diagonal( -radius - 2 );
+  const Point up = Point::diagonal(  radius + 2 );
+  KSpace K;
+  K.init( lo, up, true );
+  Ball ball;
+  ball.r2 = (long long) radius * radius;
+  std::vector< SCell > surfels;
+  Surfaces<KSpace>::sParallelMakeBoundary( surfels, K, ball, lo, up );
+  const std::size_t n = surfels.size();
+  CountedPtr< Container > container
+    ( new Container( K, SurfelAdjacency<3>( true ),
+                     std::set< SCell >( surfels.begin(), surfels.end() ) ) );
+  trace.info() << "Input: " << n << " surfels" << std::endl;
+
+  Clock c;
+  c.startClock();
+  DigSurface ref;
+  bool res = ref.build( container );
+  double t = c.stopClock();
+  trace.info() << "build through DigitalSurface: " << ref.nbFaces() << " faces in "
+               << t << " ms, " << ( 1000.0 * n / t ) << " surfels/s" << std::endl;
+  for ( unsigned int nb = 0; nb <= maxThreads; nb = ( nb == 0 ) ? 1 : 2 * nb )
+    {
+      ThreadPool pool( std::max( 1u, nb ) );
+      c.startClock();
+      DigSurface S;
+      res = S.build( container, surfels, nb == 0 ? nullptr : &pool ) && res;
+      t = c.stopClock();
+      trace.info() << "direct build, " << nb << " thread(s) in pool: "
+                   << S.nbFaces() << " faces in " << t << " ms, "
+                   << ( 1000.0 * n / t ) << " surfels/s" << std::endl;
+      res = res && S.nbVertices() == ref.nbVertices()
+        && S.nbArcs() == ref.nbArcs() && S.nbFaces() == ref.nbFaces()
+        && S.Euler() == ref.Euler();
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
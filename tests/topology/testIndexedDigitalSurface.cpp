@@ -37,7 +37,10 @@
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/graph/CUndirectedSimpleGraph.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/shapes/Shapes.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -110,6 +113,91 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
   }
 }
 
+/// @return true if both indexed digital surfaces have the same
+/// numbering of vertices, arcs and faces, and the same half-edges.
+template < typename DigSurface >
+bool sameIndexedDigitalSurfaces( const DigSurface & S1, const DigSurface & S2 )
+{
+  typedef typename DigSurface::Index Index;
+  const HalfEdgeDataStructure & H1 = S1.heds();
+  const HalfEdgeDataStructure & H2 = S2.heds();
+  bool ok = S1.nbVertices() == S2.nbVertices() && S1.nbArcs() == S2.nbArcs()
+    && S1.nbFaces() == S2.nbFaces() && H1.nbVertices() == H2.nbVertices();
+  for ( Index v = 0; ok && v < S1.nbVertices(); ++v )
+    ok = S1.surfel( v ) == S2.surfel( v ) && S1.position( v ) == S2.position( v )
+      && S2.getVertex( S1.surfel( v ) ) == v
+      && H1.halfEdgeIndexFromVertexIndex( v ) == H2.halfEdgeIndexFromVertexIndex( v );
+  for ( Index f = 0; ok && f < S1.nbFaces(); ++f )
+    ok = S1.pointel( f ) == S2.pointel( f )
+      && S1.getFace( S1.pointel( f ) ) == S2.getFace( S1.pointel( f ) )
+      && H1.halfEdgeIndexFromFaceIndex( f ) == H2.halfEdgeIndexFromFaceIndex( f );
+  for ( Index a = 0; ok && a < S1.nbArcs(); ++a )
+    {
+      const HalfEdgeDataStructure::HalfEdge & he1 = H1.halfEdge( a );
+      const HalfEdgeDataStructure::HalfEdge & he2 = H2.halfEdge( a );
+      ok = he1.toVertex == he2.toVertex && he1.face == he2.face
+        && he1.edge == he2.edge && he1.opposite == he2.opposite
+        && he1.next == he2.next
+        && S1.linel( a ) == S2.linel( a )
+        && S1.getArc( S1.linel( a ) ) == S2.getArc( S1.linel( a ) )
+        && H2.findHalfEdgeIndexFromArc( S1.tail( a ), S1.head( a ) ) == a;
+    }
+  return ok;
+}
+
+SCENARIO( "IndexedDigitalSurface< SetOfSurfels > direct build from sorted surfels", "[idxdsurf][build]" )
+{
+  typedef std::set< SCell >                           SurfelSet;
+  typedef SetOfSurfels< KSpace, SurfelSet >           DigitalSurfaceContainer;
+  typedef IndexedDigitalSurface< DigitalSurfaceContainer > DigSurface;
+  Point p1( -8, -8, -8 );
+  Point p2(  8,  8,  8 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 5 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 4, 4, 1 ), 3 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 0, 0, 0 ), 2 );
+  SurfelSet bdry;
+  Surfaces< KSpace >::sMakeBoundary( bdry, K, aSet, p1, p2 );
+  SurfelSet half;
+  for ( auto s : bdry )
+    if ( K.sCoords( s )[ 2 ] <= 1 ) half.insert( s );
+  for ( bool interior : { true, false } )
+    for ( const SurfelSet * surfels : { &bdry, &half } )
+      {
+        SurfelAdjacency< KSpace::dimension > surfAdj( interior );
+        CountedPtr< DigitalSurfaceContainer > container
+          ( new DigitalSurfaceContainer( K, surfAdj, *surfels ) );
+        DigSurface S1, S2, S3;
+        const bool ok1 = S1.build( container );
+        const bool ok2 = S2.build( container, std::vector< SCell >( surfels->begin(), surfels->end() ) );
+        ThreadPool pool( 3 );
+        const bool ok3 = S3.build( container, std::vector< SCell >( surfels->begin(), surfels->end() ), &pool );
+        GIVEN( "A closed or open surface with " << surfels->size() << " surfels, interior adjacency " << interior ) {
+          THEN( "Both builds succeed or fail together" ) {
+            REQUIRE( ok1 == ok2 );
+            REQUIRE( ok1 == ok3 );
+          }
+          THEN( "The direct build gives the same indexed digital surface" ) {
+            REQUIRE( S1.nbFaces() > 0 );
+            REQUIRE( sameIndexedDigitalSurfaces( S1, S2 ) );
+            REQUIRE( sameIndexedDigitalSurfaces( S1, S3 ) );
+          }
+        }
+      }
+  WHEN( "Surfels are not sorted" ) {
+    SurfelAdjacency< KSpace::dimension > surfAdj( true );
+    CountedPtr< DigitalSurfaceContainer > container
+      ( new DigitalSurfaceContainer( K, surfAdj, bdry ) );
+    std::vector< SCell > surfels( bdry.rbegin(), bdry.rend() );
+    DigSurface S;
+    THEN( "The direct build fails" ) {
+      REQUIRE( ! S.build( container, surfels ) );
+    }
+  }
+}
+
 SCENARIO( "IndexedDigitalSurface< RealPoint3 > concept check tests", "[idxdsurf][concepts]" )
 {
   typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
@@ -0,0 +1,169 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class KhalimskyCellPacker.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KhalimskyCellPacker.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that the operations on codes give the same cells as the
+ * ones of the Khalimsky space, on random signed cells of @a K.
+ */
+template <typename KSpace>
+void checkPacker( const KSpace & K, int nb )
+{
+  typedef KhalimskyCellPacker<KSpace> Packer;
+  typedef typename KSpace::Point      Point;
+  typedef typename KSpace::SCell      SCell;
+  typedef typename Packer::Code       Code;
+  Packer packer( K );
+  REQUIRE( packer.isValid() );
+  for ( int n = 0; n < nb; ++n )
+    {
+      Point p;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        {
+          const auto lo = K.uKCoord( K.lowerCell(), k );
+          const auto up = K.uKCoord( K.upperCell(), k );
+          p[ k ] = lo + rand() % ( up - lo + 1 );
+        }
+      const SCell c = K.sCell( p, rand() % 2 == 0 );
+      const Code code = packer.pack( c );
+      REQUIRE( packer.unpackSCell( code ) == c );
+      REQUIRE( packer.unpackCell( Packer::unsigns( code ) ) == K.unsigns( c ) );
+      REQUIRE( packer.pack( K.unsigns( c ) ) == Packer::unsigns( code ) );
+      REQUIRE( packer.uDim( code ) == K.sDim( c ) );
+      REQUIRE( Packer::sSign( code ) == K.sSign( c ) );
+      REQUIRE( packer.unpackSCell( Packer::sOpp( code ) ) == K.sOpp( c ) );
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        {
+          REQUIRE( packer.uIsOpen( code, k ) == K.sIsOpen( c, k ) );
+          REQUIRE( packer.sDirect( code, k ) == K.sDirect( c, k ) );
+          for ( bool up : { false, true } )
+            {
+              if ( up ? K.sIsMax( c, k ) : K.sIsMin( c, k ) ) continue;
+              REQUIRE( packer.unpackSCell( packer.sIncident( code, k, up ) )
+                       == K.sIncident( c, k, up ) );
+              REQUIRE( packer.unpackCell( packer.uIncident( Packer::unsigns( code ), k, up ) )
+                       == K.uIncident( K.unsigns( c ), k, up ) );
+            }
+          if ( K.sIsOpen( c, k ) )
+            {
+              REQUIRE( packer.unpackSCell( packer.sDirectIncident( code, k ) )
+                       == K.sDirectIncident( c, k ) );
+              REQUIRE( packer.unpackSCell( packer.sIndirectIncident( code, k ) )
+                       == K.sIndirectIncident( c, k ) );
+            }
+          const SCell q = K.sAdjacent( c, k, true );
+          if ( K.sIsInside( q ) )
+            REQUIRE( packer.unpackSCell( packer.uAdjacent( code, k, true ) ) == q );
+        }
+    }
+}
+
+TEST_CASE( "Testing KhalimskyCellPacker" )
+{
+  srand( 0 );
+  typedef KhalimskySpaceND< 2, DGtal::int32_t > KSpace2;
+  typedef KhalimskySpaceND< 3, DGtal::int32_t > KSpace3;
+  typedef KhalimskySpaceND< 3, DGtal::int64_t > KSpace3L;
+
+  SECTION( "Closed and open 2D spaces" )
+    {
+      KSpace2 K;
+      REQUIRE( K.init( KSpace2::Point( -7, 3 ), KSpace2::Point( 12, 40 ), true ) );
+      checkPacker( K, 1000 );
+      REQUIRE( K.init( KSpace2::Point( -7, 3 ), KSpace2::Point( 12, 40 ), false ) );
+      checkPacker( K, 1000 );
+    }
+
+  SECTION( "Closed and open 3D spaces" )
+    {
+      KSpace3 K;
+      REQUIRE( K.init( KSpace3::Point( -100, 0, 5 ), KSpace3::Point( 411, 17, 6 ), true ) );
+      checkPacker( K, 5000 );
+      REQUIRE( K.init( KSpace3::Point( -100, 0, 5 ), KSpace3::Point( 411, 17, 6 ), false ) );
+      checkPacker( K, 5000 );
+      KhalimskyCellPacker< KSpace3 > packer( K );
+      REQUIRE( packer.nbBits() == 11 + 6 + 3 );
+    }
+
+  SECTION( "Large 3D space" )
+    {
+      KSpace3L K;
+      const DGtal::int64_t big = 100000;
+      REQUIRE( K.init( KSpace3L::Point::diagonal( -big ), KSpace3L::Point::diagonal( big ), true ) );
+      checkPacker( K, 5000 );
+      REQUIRE( K.init( KSpace3L::Point::diagonal( -big*big ), KSpace3L::Point::diagonal( big*big ), true ) );
+      KhalimskyCellPacker< KSpace3L > packer( K );
+      REQUIRE( ! packer.isValid() );
+    }
+
+  SECTION( "Periodic spaces are not supported" )
+    {
+      KSpace3 K;
+      REQUIRE( K.init( KSpace3::Point( 0, 0, 0 ), KSpace3::Point( 9, 9, 9 ),
+                       KSpace3::PERIODIC ) );
+      KhalimskyCellPacker< KSpace3 > packer( K );
+      REQUIRE( ! packer.isValid() );
+    }
+
+  SECTION( "Codes of a set of cells" )
+    {
+      KSpace3 K;
+      REQUIRE( K.init( KSpace3::Point( 0, 0, 0 ), KSpace3::Point( 9, 9, 9 ), true ) );
+      KhalimskyCellPacker< KSpace3 > packer( K );
+      std::unordered_set< KhalimskyCellPacker< KSpace3 >::Code > codes;
+      std::set< KSpace3::SCell > cells;
+      for ( int n = 0; n < 1000; ++n )
+        {
+          KSpace3::SCell c = K.sCell( KSpace3::Point( rand() % 21, rand() % 21, rand() % 21 ),
+                                      rand() % 2 == 0 );
+          codes.insert( packer.pack( c ) );
+          cells.insert( c );
+        }
+      REQUIRE( codes.size() == cells.size() );
+      for ( auto code : codes )
+        REQUIRE( cells.count( packer.unpackSCell( code ) ) == 1 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,138 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class NeighborhoodTableRegistry.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/NeighborhoodTableRegistry.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NeighborhoodTableRegistry.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Reads a compressed table with the stream operator of dynamic_bitset.
+boost::dynamic_bitset<> streamedTable( const std::string & filename, unsigned int size )
+{
+  boost::dynamic_bitset<> table( size );
+  std::ifstream in_file( filename, std::ios::binary );
+  namespace io = boost::iostreams;
+  io::filtering_streambuf<io::input> filter;
+  filter.push( io::zlib_decompressor() );
+  filter.push( in_file );
+  std::stringstream decompressed;
+  io::copy( filter, decompressed );
+  decompressed >> table;
+  return table;
+}
+
+TEST_CASE( "Testing NeighborhoodTableRegistry" )
+{
+  NeighborhoodTableRegistry::setCacheDirectory( "" );
+  NeighborhoodTableRegistry::clear();
+
+  SECTION( "loadTable reads the same bits as the stream operator" )
+    {
+      REQUIRE( *functions::loadTable<2>( simplicity::tableSimple4_8 )
+               == streamedTable( simplicity::tableSimple4_8, 256 ) );
+      REQUIRE( *functions::loadTable( simplicity::tableSimple26_6 )
+               == streamedTable( simplicity::tableSimple26_6, 67108864 ) );
+    }
+
+  SECTION( "Tables are loaded once and shared" )
+    {
+      auto t1 = NeighborhoodTableRegistry::table<3>( simplicity::tableSimple26_6 );
+      auto t2 = NeighborhoodTableRegistry::table( simplicity::tableSimple26_6, 67108864 );
+      REQUIRE( t1.get() == t2.get() );
+      REQUIRE( t1->size() == 67108864 );
+      REQUIRE( *t1 == *functions::loadTable( simplicity::tableSimple26_6 ) );
+      const auto info = NeighborhoodTableRegistry::loadingInfo( simplicity::tableSimple26_6 );
+      REQUIRE( info.source == "compressed" );
+      REQUIRE( info.nbRequests == 2 );
+      REQUIRE( info.time >= 0.0 );
+      REQUIRE( NeighborhoodTableRegistry::loadingInfo( simplicity::tableSimple6_26 ).source
+               == "none" );
+
+      // Complexes share the table of the registry.
+      typedef VoxelComplex< Z3i::KSpace > Complex;
+      Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 3 ) );
+      Z3i::DigitalSet set( domain );
+      set.insert( Z3i::Point( 1, 1, 1 ) );
+      Z3i::KSpace K;
+      K.init( domain.lowerBound(), domain.upperBound(), true );
+      Complex vc1( K ), vc2( K );
+      vc1.construct( set, t1 );
+      vc2.construct( set, NeighborhoodTableRegistry::table<3>( simplicity::tableSimple26_6 ) );
+      REQUIRE( &vc1.table() == &vc2.table() );
+      trace.info() << NeighborhoodTableRegistry() << std::endl;
+    }
+
+  SECTION( "Tables are cached uncompressed" )
+    {
+      NeighborhoodTableRegistry::setCacheDirectory( "." );
+      const std::string cache =
+        NeighborhoodTableRegistry::cacheFilename( simplicity::tableSimple4_8 );
+      REQUIRE( cache == "./simplicity_table4_8.zlib.bits" );
+      std::remove( cache.c_str() );
+      auto t1 = NeighborhoodTableRegistry::table<2>( simplicity::tableSimple4_8 );
+      REQUIRE( NeighborhoodTableRegistry::loadingInfo( simplicity::tableSimple4_8 ).source
+               == "compressed" );
+      REQUIRE( std::ifstream( cache ).good() );
+      NeighborhoodTableRegistry::clear();
+      auto t2 = NeighborhoodTableRegistry::table<2>( simplicity::tableSimple4_8 );
+      REQUIRE( NeighborhoodTableRegistry::loadingInfo( simplicity::tableSimple4_8 ).source
+               == "cache" );
+      REQUIRE( t1.get() != t2.get() );
+      REQUIRE( *t1 == *t2 );
+      // A corrupted cache file is ignored.
+      {
+        std::ofstream out( cache, std::ios::binary );
+        out << "garbage";
+      }
+      NeighborhoodTableRegistry::clear();
+      auto t3 = NeighborhoodTableRegistry::table<2>( simplicity::tableSimple4_8 );
+      REQUIRE( NeighborhoodTableRegistry::loadingInfo( simplicity::tableSimple4_8 ).source
+               == "compressed" );
+      REQUIRE( *t1 == *t3 );
+      std::remove( cache.c_str() );
+      NeighborhoodTableRegistry::setCacheDirectory( "" );
+    }
+  NeighborhoodTableRegistry::clear();
+}
+
+/** @ingroup Tests **/
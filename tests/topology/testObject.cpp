@@ -43,6 +43,7 @@
 #include "DGtal/topology/DomainAdjacency.h"
 #include "DGtal/topology/DigitalTopology.h"
 #include "DGtal/topology/Object.h"
+#include "DGtal/topology/BorderQueueThinning.h"
 #include "DGtal/graph/Expander.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/Color.h"
@@ -812,6 +813,87 @@ bool testSetTable()
   return nbok == nb;
 
 }
+bool testBorderQueueThinning()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef DGtal::Z2i::Point Point;
+
+  trace.beginBlock ( "Border queue thinning with table..." );
+  Point p1( -17, -17 );
+  Point p2( 17, 17 );
+  Domain domain( p1, p2 );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -10, -8 ), 7 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 10, 8 ), 7 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 3, 0 ), 6 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 0, -3 ), 7 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -10, 0 ), 6 );
+  shape_set.erase( Point( 5, 0 ) );
+  shape_set.erase( Point( -1, -2 ) );
+  const auto nb_points = shape_set.size();
+  Object4_8 shape( dt4_8, shape_set );
+  std::vector<Object4_8> components;
+  auto itComponents = std::back_inserter( components );
+  const auto nb_components = shape.writeComponents( itComponents );
+  auto table = functions::loadTable<2>( simplicity::tableSimple4_8 );
+  std::vector<Point> removed;
+  const auto nb_removed =
+    functions::borderQueueThinning( shape, *table, std::back_inserter( removed ) );
+  const DigitalSet & S = shape.pointSet();
+  trace.info() << "removed " << nb_removed << " / " << nb_points
+               << " points, " << S.size() << " remaining" << std::endl;
+  nbok += ( nb_removed == removed.size() ) ? 1 : 0;
+  nb++;
+  nbok += ( nb_removed + S.size() == nb_points ) ? 1 : 0;
+  nb++;
+  std::set<Point> removed_set( removed.begin(), removed.end() );
+  nbok += ( removed_set.size() == removed.size() ) ? 1 : 0;
+  nb++;
+  // Ultimate thinning: no simple point remains, components and holes are kept.
+  bool no_simple = true;
+  for ( auto it = S.begin(), itE = S.end(); it != itE; ++it )
+    no_simple = no_simple && ! shape.isSimpleFromTable
+      ( *it, *table, *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>() );
+  nbok += no_simple ? 1 : 0;
+  nb++;
+  components.clear();
+  nbok += ( shape.writeComponents( itComponents ) == nb_components ) ? 1 : 0;
+  nb++;
+  nbok += ( S.find( Point( 5, 0 ) ) == S.end() && S.size() > 2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D thinning is an ultimate skeleton with the same components" << std::endl;
+
+  // A 3D ball is thinned to a single point.
+  typedef Z3i::Point Point3;
+  Z3i::Domain domain3( Point3::diagonal( -8 ), Point3::diagonal( 8 ) );
+  Z3i::DigitalSet ball( domain3 );
+  Shapes<Z3i::Domain>::addNorm2Ball( ball, Point3::diagonal( 0 ), 6 );
+  Z3i::Object26_6 ball_obj( Z3i::dt26_6, ball );
+  auto table3 = functions::loadTable( simplicity::tableSimple26_6 );
+  std::vector<Point3> removed3;
+  functions::borderQueueThinning
+    ( ball_obj, *table3, std::back_inserter( removed3 ), nullptr,
+      [] ( const Point3 & p ) { return - p.norm(); } );
+  nbok += ( ball_obj.size() == 1 && removed3.size() + 1 == ball.size() ) ? 1 : 0;
+  nb++;
+  // End points are kept with a skeleton predicate.
+  Z3i::Object26_6 ball_obj2( Z3i::dt26_6, ball );
+  std::vector<Point3> removed4;
+  functions::borderQueueThinning
+    ( ball_obj2, *table3, std::back_inserter( removed4 ),
+      [] ( const Z3i::Object26_6 & obj, const Point3 & p ) {
+        return obj.properNeighborhoodSize( p ) == 1; } );
+  nbok += ( ball_obj2.size() >= 1 && ball_obj2.computeConnectedness() == CONNECTED ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D ball thinned to " << ball_obj.size() << " point" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -828,7 +910,8 @@ int main( int argc, char** argv )
     && testSimplePoints3D()
     && testSimplePoints2D()
     && testObjectGraph()
-    && testSetTable();
+    && testSetTable()
+    && testBorderQueueThinning();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of PackedSurfelSet against std::set and
+ * std::unordered_set as the surfel set of SetOfSurfels.
+ *
+ * Usage: testPackedSurfelSet-benchmark [radius]
+ * (default: the boundary of a ball of radius 128).
+ * For each surfel set, the set is filled with the boundary of the
+ * ball, then a breadth-first traversal of the DigitalSurface and the
+ * computation of the four adjacent surfels of each surfel by the
+ * tracker of SetOfSurfels, both driven by the surfel queries of the
+ * set, are timed.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <unordered_set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/PackedSurfelSet.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace   KSpace;
+typedef Z3i::Point    Point;
+typedef KSpace::SCell SCell;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/// The characteristic function of a ball centered at the origin.
+struct Ball
+{
+  typedef Z3i::Point Point;
+  long long r2;
+  bool operator()( const Point & p ) const
+  { return (long long) p[ 0 ] * p[ 0 ] + (long long) p[ 1 ] * p[ 1 ]
+      + (long long) p[ 2 ] * p[ 2 ] <= r2; }
+};
+
+/// Builds a surfel set of type TSurfelSet from a range of surfels.
+template <typename TSurfelSet>
+struct SurfelSetMaker
+{
+  static TSurfelSet make( const KSpace &, const std::vector< SCell > & surfels )
+  { return TSurfelSet( surfels.begin(), surfels.end() ); }
+};
+
+/// Builds a PackedSurfelSet from a range of surfels.
+template <>
+struct SurfelSetMaker< PackedSurfelSet< KSpace > >
+{
+  static PackedSurfelSet< KSpace > make( const KSpace & K, const std::vector< SCell > & surfels )
+  { return PackedSurfelSet< KSpace >( K, surfels.begin(), surfels.end() ); }
+};
+
+/**
+ * Fills a SetOfSurfels with the surfels, then traverses its digital
+ * surface and tracks the adjacent surfels of each surfel.
+ *
+ * @param name the name of the surfel set, for display.
+ * @param K the Khalimsky space.
+ * @param surfels the surfels of the boundary of the ball.
+ * @param nbVisited (returns) the number of surfels visited by the traversal.
+ * @param nbAdjacent (returns) the number of adjacent surfels found by the tracker.
+ * @return the total time in ms.
+ */
+template <typename TSurfelSet>
+double benchmark( const std::string & name, const KSpace & K,
+                  const std::vector< SCell > & surfels,
+                  std::size_t & nbVisited, std::size_t & nbAdjacent )
+{
+  typedef SetOfSurfels< KSpace, TSurfelSet > Container;
+  typedef DigitalSurface< Container >        Surface;
+  trace.beginBlock( name );
+  Clock c;
+  c.startClock();
+  CountedPtr< Container > container
+    ( new Container( K, SurfelAdjacency<3>( true ),
+                     SurfelSetMaker< TSurfelSet >::make( K, surfels ) ) );
+  const double t1 = c.stopClock();
+  trace.info() << "Surfel set: " << container->nbSurfels() << " surfels in "
+               << t1 << " ms" << std::endl;
+
+  c.startClock();
+  Surface surface( *container );
+  BreadthFirstVisitor< Surface > visitor( surface, surfels[ 0 ] );
+  nbVisited = 0;
+  for ( ; ! visitor.finished(); visitor.expand() ) ++nbVisited;
+  const double t2 = c.stopClock();
+  trace.info() << "Breadth-first traversal: " << nbVisited << " surfels in "
+               << t2 << " ms" << std::endl;
+
+  c.startClock();
+  typename Container::DigitalSurfaceTracker* tracker = container->newTracker( surfels[ 0 ] );
+  SCell adjSurfel;
+  nbAdjacent = 0;
+  for ( auto&& s : surfels )
+    {
+      tracker->move( s );
+      const Dimension orth = K.sOrthDir( s );
+      for ( Dimension k = 0; k < 3; ++k )
+        if ( k != orth )
+          for ( bool pos : { false, true } )
+            nbAdjacent += tracker->adjacent( adjSurfel, k, pos ) != 0 ? 1 : 0;
+    }
+  delete tracker;
+  const double t3 = c.stopClock();
+  trace.info() << "Tracker: " << nbAdjacent << " adjacent surfels in "
+               << t3 << " ms" << std::endl;
+  trace.endBlock();
+  return t1 + t2 + t3;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking PackedSurfelSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int radius = argc > 1 ? atoi( argv[ 1 ] ) : 128;
+  const Point lo = Point::diagonal( -radius - 2 );
+  const Point up = Point::diagonal(  radius + 2 );
+  KSpace K;
+  K.init( lo, up, true );
+  Ball ball;
+  ball.r2 = (long long) radius * radius;
+  std::vector< SCell > surfels;
+  Surfaces<KSpace>::sParallelMakeBoundary( surfels, K, ball, lo, up );
+  trace.info() << "Input: " << surfels.size() << " surfels" << std::endl;
+
+  std::size_t v1, v2, v3, n1, n2, n3;
+  const double t1 = benchmark< std::set< SCell > >
+    ( "std::set<SCell>", K, surfels, v1, n1 );
+  const double t2 = benchmark< std::unordered_set< SCell > >
+    ( "std::unordered_set<SCell>", K, surfels, v2, n2 );
+  const double t3 = benchmark< PackedSurfelSet< KSpace > >
+    ( "PackedSurfelSet", K, surfels, v3, n3 );
+  trace.info() << "Speedup of PackedSurfelSet: " << ( t1 / t3 )
+               << "x vs std::set, " << ( t2 / t3 )
+               << "x vs std::unordered_set" << std::endl;
+  bool res = v1 == surfels.size() && v2 == v1 && v3 == v1
+    && n1 == 4 * surfels.size() && n2 == n1 && n3 == n1;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,141 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedSurfelSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/PackedSurfelSet.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedSurfelSet.
+///////////////////////////////////////////////////////////////////////////////
+
+/// The characteristic function of a ball centered at the origin.
+struct Ball
+{
+  typedef Z3i::Point Point;
+  int r2;
+  bool operator()( const Point & p ) const
+  { return p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] + p[ 2 ] * p[ 2 ] <= r2; }
+};
+
+TEST_CASE( "Testing PackedSurfelSet" )
+{
+  srand( 0 );
+  typedef Z3i::KSpace               KSpace;
+  typedef KSpace::Point             Point;
+  typedef KSpace::SCell             SCell;
+  typedef PackedSurfelSet< KSpace > SurfelSet;
+
+  KSpace K;
+  REQUIRE( K.init( Point( -10, -4, 0 ), Point( 10, 12, 7 ), true ) );
+
+  SECTION( "Set services are those of std::set" )
+    {
+      SurfelSet packed( K );
+      REQUIRE( packed.isValid() );
+      REQUIRE( packed.empty() );
+      std::set< SCell > cells;
+      for ( int n = 0; n < 2000; ++n )
+        {
+          const SCell c = K.sCell( Point( -20 + rand() % 41, -8 + rand() % 33, rand() % 15 ),
+                                   rand() % 2 == 0 );
+          const bool inserted = cells.insert( c ).second;
+          const auto res = packed.insert( c );
+          REQUIRE( res.second == inserted );
+          REQUIRE( *res.first == c );
+        }
+      REQUIRE( packed.size() == cells.size() );
+      REQUIRE( std::set< SCell >( packed.begin(), packed.end() ) == cells );
+      for ( int n = 0; n < 2000; ++n )
+        {
+          const SCell c = K.sCell( Point( -20 + rand() % 41, -8 + rand() % 33, rand() % 15 ),
+                                   rand() % 2 == 0 );
+          REQUIRE( packed.count( c ) == cells.count( c ) );
+          REQUIRE( ( packed.find( c ) != packed.end() ) == ( cells.find( c ) != cells.end() ) );
+          if ( n % 2 == 0 )
+            REQUIRE( packed.erase( c ) == cells.erase( c ) );
+        }
+      REQUIRE( std::set< SCell >( packed.begin(), packed.end() ) == cells );
+      // Cells outside the bounds are never found.
+      REQUIRE( packed.count( K.sCell( Point( 41, -8, 0 ) ) ) == 0 );
+      REQUIRE( packed.find( K.sCell( Point( -21, 25, 15 ) ) ) == packed.end() );
+      packed.clear();
+      REQUIRE( packed.empty() );
+    }
+
+  SECTION( "Surfel set of SetOfSurfels" )
+    {
+      typedef SetOfSurfels< KSpace, std::set< SCell > > SetContainer;
+      typedef SetOfSurfels< KSpace, SurfelSet >         PackedContainer;
+      Ball ball;
+      ball.r2 = 30;
+      REQUIRE( K.init( Point::diagonal( -8 ), Point::diagonal( 8 ), true ) );
+      std::vector< SCell > surfels;
+      Surfaces<KSpace>::sParallelMakeBoundary( surfels, K, ball, K.lowerBound(), K.upperBound() );
+      const SurfelAdjacency<3> adj( true );
+      CountedPtr< SetContainer > setC
+        ( new SetContainer( K, adj, std::set< SCell >( surfels.begin(), surfels.end() ) ) );
+      CountedPtr< PackedContainer > packedC
+        ( new PackedContainer( K, adj, SurfelSet( K, surfels.begin(), surfels.end() ) ) );
+      REQUIRE( packedC->nbSurfels() == setC->nbSurfels() );
+      for ( auto&& s : surfels )
+        REQUIRE( packedC->isInside( s ) );
+      REQUIRE( ! packedC->isInside( K.sOpp( surfels[ 0 ] ) ) );
+
+      DigitalSurface< PackedContainer > surface( *packedC );
+      REQUIRE( surface.size() == surfels.size() );
+      BreadthFirstVisitor< DigitalSurface< PackedContainer > > visitor( surface, surfels[ 0 ] );
+      std::size_t nbVisited = 0;
+      for ( ; ! visitor.finished(); visitor.expand() ) ++nbVisited;
+      REQUIRE( nbVisited == surfels.size() );
+      IndexedDigitalSurface< SetContainer > setS( setC );
+      IndexedDigitalSurface< PackedContainer > packedS( packedC );
+      REQUIRE( packedS.isValid() );
+      REQUIRE( packedS.nbVertices() == setS.nbVertices() );
+      REQUIRE( packedS.nbArcs() == setS.nbArcs() );
+      REQUIRE( packedS.nbFaces() == setS.nbFaces() );
+      REQUIRE( packedS.Euler() == 2 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,147 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the slab-parallel boundary extraction of
+ * Surfaces against uMakeBoundary and extractAllConnectedSCell.
+ *
+ * Usage: testParallelMakeBoundary-benchmark [size] [maxThreads]
+ * (default: random balls in a 128^3 binary image, up to the number of
+ * hardware threads).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <thread>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace KSpace;
+typedef Z3i::Point  Point;
+typedef Z3i::Domain Domain;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/// A dense binary image read as a point predicate.
+struct BinaryImage
+{
+  typedef Z3i::Point Point;
+  Point lower, extent;
+  std::vector<char> data;
+  BinaryImage( const Point & lo, const Point & up )
+    : lower( lo ), extent( up - lo + Point::diagonal( 1 ) ),
+      data( std::size_t( extent[ 0 ] ) * extent[ 1 ] * extent[ 2 ], 0 ) {}
+  std::size_t index( const Point & p ) const
+  {
+    const Point q = p - lower;
+    return ( std::size_t( q[ 2 ] ) * extent[ 1 ] + q[ 1 ] ) * extent[ 0 ] + q[ 0 ];
+  }
+  bool operator()( const Point & p ) const { return data[ index( p ) ] != 0; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking parallel boundary extraction" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 128;
+  const unsigned int maxThreads = argc > 2 ? (unsigned int) atoi( argv[ 2 ] )
+    : std::max( 1u, std::thread::hardware_concurrency() );
+  const Point lo = Point::diagonal( 0 );
+  const Point up = Point::diagonal( size - 1 );
+  BinaryImage image( lo, up );
+  srand( 0 );
+  for ( int b = 0; b < 64; ++b )
+    {
+      const Point c( rand() % size, rand() % size, rand() % size );
+      const int r = 1 + rand() % std::max( 1, size / 8 );
+      for ( auto p : Domain( ( c - Point::diagonal( r ) ).sup( lo ),
+                             ( c + Point::diagonal( r ) ).inf( up ) ) )
+        if ( ( p - c ).squaredNorm() <= r * r ) image.data[ image.index( p ) ] = 1;
+    }
+  KSpace K;
+  K.init( lo, up, true );
+
+  Clock c;
+  c.startClock();
+  std::set< KSpace::Cell > bdry;
+  Surfaces<KSpace>::uMakeBoundary( bdry, K, image, lo, up );
+  double t = c.stopClock();
+  trace.info() << "uMakeBoundary: " << bdry.size() << " surfels in " << t << " ms" << std::endl;
+  const std::vector< KSpace::Cell > reference( bdry.begin(), bdry.end() );
+  bdry.clear();
+
+  bool res = true;
+  for ( unsigned int n = 1; n <= maxThreads; n *= 2 )
+    {
+      ThreadPool pool( n );
+      std::vector< KSpace::Cell > cells;
+      c.startClock();
+      Surfaces<KSpace>::uParallelMakeBoundary( cells, K, image, lo, up, &pool );
+      t = c.stopClock();
+      trace.info() << "uParallelMakeBoundary, " << n << " thread(s): "
+                   << cells.size() << " surfels in " << t << " ms" << std::endl;
+      res = res && ( cells == reference );
+    }
+
+  SurfelAdjacency<3> SAdj( true );
+  std::vector< std::vector< KSpace::SCell > > tracked;
+  c.startClock();
+  Surfaces<KSpace>::extractAllConnectedSCell( tracked, K, SAdj, image );
+  t = c.stopClock();
+  trace.info() << "extractAllConnectedSCell: " << tracked.size()
+               << " components in " << t << " ms" << std::endl;
+  for ( unsigned int n = 1; n <= maxThreads; n *= 2 )
+    {
+      ThreadPool pool( n );
+      std::vector< std::vector< KSpace::SCell > > split;
+      c.startClock();
+      Surfaces<KSpace>::parallelExtractAllConnectedSCell( split, K, SAdj, image, false, &pool );
+      t = c.stopClock();
+      trace.info() << "parallelExtractAllConnectedSCell, " << n << " thread(s): "
+                   << split.size() << " components in " << t << " ms" << std::endl;
+      res = res && ( split == tracked );
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,8 @@
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -315,6 +317,131 @@ bool testFindABel()
 }
 
 
+/**
+* Checks that the slab-parallel boundary extraction and component
+* split give the same surfels as uMakeBoundary, sMakeBoundary and
+* extractAllConnectedSCell.
+*/
+bool testParallelMakeBoundary()
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::Point Point;
+  typedef KSpace::Cell Cell;
+  typedef KSpace::SCell SCell;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing parallel boundary extraction ..." );
+  Point p1( -12, -10, -11 );
+  Point p2(  12,  11,  10 );
+  Z3i::Domain domain( p1, p2 );
+  Z3i::DigitalSet aSet( domain );
+  // A hollow ball (two boundary components), a ball and a ball
+  // touching the border of the domain.
+  Shapes<Z3i::Domain>::addNorm2Ball( aSet, Point( -4, 0, 0 ), 6 );
+  Shapes<Z3i::Domain>::removeNorm2Ball( aSet, Point( -4, 0, 0 ), 3 );
+  Shapes<Z3i::Domain>::addNorm2Ball( aSet, Point( 7, 5, 4 ), 3 );
+  Shapes<Z3i::Domain>::addNorm2Ball( aSet, Point( 10, -8, -9 ), 4 );
+  KSpace K;
+  K.init( p1, p2, true );
+  ThreadPool pool( 3 );
+  for ( int i = 0; i < 2; ++i )
+    {
+      ThreadPool * aThreadPool = ( i == 0 ) ? nullptr : &pool;
+      std::set<Cell> uSet;
+      Surfaces<KSpace>::uMakeBoundary( uSet, K, aSet, K.lowerBound(), K.upperBound() );
+      std::vector<Cell> uVect;
+      Surfaces<KSpace>::uParallelMakeBoundary( uVect, K, aSet,
+                                               K.lowerBound(), K.upperBound(), aThreadPool );
+      ++nb; nbok += std::vector<Cell>( uSet.begin(), uSet.end() ) == uVect ? 1 : 0;
+      std::set<SCell> sSet;
+      Point low( -6, -3, -4 ), up( 11, 7, 9 );
+      Surfaces<KSpace>::sMakeBoundary( sSet, K, aSet, low, up );
+      std::vector<SCell> sVect;
+      Surfaces<KSpace>::sParallelMakeBoundary( sVect, K, aSet, low, up, aThreadPool );
+      ++nb; nbok += std::vector<SCell>( sSet.begin(), sSet.end() ) == sVect ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") " << uVect.size()
+                   << " unsigned and " << sVect.size() << " signed surfels." << std::endl;
+      for ( int interior = 0; interior < 2; ++interior )
+        {
+          SurfelAdjacency<3> SAdj( interior == 1 );
+          std::vector< std::vector<SCell> > tracked, split;
+          Surfaces<KSpace>::extractAllConnectedSCell( tracked, K, SAdj, aSet, true );
+          Surfaces<KSpace>::parallelExtractAllConnectedSCell( split, K, SAdj, aSet,
+                                                              true, aThreadPool );
+          ++nb; nbok += ( tracked == split && split.size() == 4 ) ? 1 : 0;
+          trace.info() << "(" << nbok << "/" << nb << ") " << split.size()
+                       << " connected components (should be 4)." << std::endl;
+        }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/// The voxels of a given label in a label image.
+struct LabelPredicate
+{
+  typedef Z3i::Point Point;
+  const ImageContainerBySTLVector< Z3i::Domain, int > * image;
+  int label;
+  bool operator()( const Point & p ) const { return (*image)( p ) == label; }
+};
+
+bool testLabelBoundaries()
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::Point Point;
+  typedef KSpace::SCell SCell;
+  typedef ImageContainerBySTLVector< Z3i::Domain, int > LabelImage;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing label boundaries extraction ..." );
+  Point p1( -9, -8, -10 );
+  Point p2(  8,  9,  7 );
+  Z3i::Domain domain( p1, p2 );
+  LabelImage image( domain );
+  const Point c[ 3 ] = { Point( -2, 0, 0 ), Point( 3, 1, 0 ), Point( 6, 7, -8 ) };
+  const int   r[ 3 ] = { 6, 4, 4 };
+  const int   l[ 3 ] = { 1, 5, 3 };
+  for ( auto p : domain )
+    {
+      image.setValue( p, 0 );
+      for ( int i = 0; i < 3; ++i )
+        if ( ( p - c[ i ] ).squaredNorm() <= r[ i ] * r[ i ] ) image.setValue( p, l[ i ] );
+    }
+  KSpace K;
+  K.init( p1, p2, true );
+  std::map< std::pair< int, int >, std::vector< SCell > > bdries;
+  Surfaces<KSpace>::sMakeLabelBoundaries( bdries, K, image );
+  ++nb; nbok += bdries.size() == 4 ? 1 : 0; // 0-1, 0-3, 0-5, 1-5
+  trace.info() << "(" << nbok << "/" << nb << ") " << bdries.size()
+               << " pairs of labels in contact (should be 4)." << std::endl;
+  for ( int label : { 0, 1, 3, 5 } )
+    {
+      LabelPredicate pred;
+      pred.image = &image;
+      pred.label = label;
+      std::set< SCell > expected;
+      Surfaces<KSpace>::sMakeBoundary( expected, K, pred, p1, p2 );
+      std::set< SCell > computed;
+      for ( const auto & b : bdries )
+        {
+          if ( b.first.first == label )
+            computed.insert( b.second.begin(), b.second.end() );
+          else if ( b.first.second == label )
+            for ( const auto & s : b.second ) computed.insert( K.sOpp( s ) );
+        }
+      ++nb; nbok += computed == expected ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") label " << label << ": "
+                   << computed.size() << " surfels." << std::endl;
+    }
+  bool sorted = true;
+  for ( const auto & b : bdries )
+    sorted = sorted && std::is_sorted( b.second.begin(), b.second.end() );
+  ++nb; nbok += sorted ? 1 : 0;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -327,7 +454,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testParallelMakeBoundary() && testLabelBoundaries();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
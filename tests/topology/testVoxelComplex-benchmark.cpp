@@ -0,0 +1,164 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the critical kernel thinning of VoxelComplex with a
+ * ThreadPool.
+ *
+ * Usage: testVoxelComplex-benchmark [size] [maxThreads]
+ * (default: a tree of tubes in a 64^3 domain, up to the number of
+ * hardware threads). The asymmetric thinning scheme preserving
+ * isthmuses is run with 1, 2, 4, ... threads and the number of input
+ * voxels processed per second is reported, then the sequential border
+ * queue thinning is timed with the same skeleton predicate.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace                                      KSpace;
+typedef Z3i::Point                                       Point;
+typedef Z3i::Domain                                      Domain;
+typedef std::unordered_map< KSpace::Cell, CubicalCellData > Map;
+typedef VoxelComplex< KSpace, Map >                      Complex;
+typedef DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > DigitalSet;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Inserts in @a set a binary tree of tubes starting at @a p and going
+ * up along z, as a crude model of a vascular tree.
+ */
+void tubeTree( DigitalSet & set, const Point & p, int length, int radius, int depth )
+{
+  const Domain & domain = set.domain();
+  const int dx = ( depth % 2 == 0 ) ? 1 : 0;
+  const int dy = 1 - dx;
+  for ( int side = -1; side <= 1; side += 2 )
+    {
+      Point q = p;
+      for ( int t = 0; t < length; ++t )
+        {
+          const Point c = p + Point( side * dx * t / 2, side * dy * t / 2, t );
+          for ( int x = -radius; x <= radius; ++x )
+            for ( int y = -radius; y <= radius; ++y )
+              for ( int z = -radius; z <= radius; ++z )
+                {
+                  const Point r = c + Point( x, y, z );
+                  if ( x*x + y*y + z*z <= radius*radius && domain.isInside( r ) )
+                    set.insert( r );
+                }
+          q = c;
+        }
+      if ( depth > 0 )
+        tubeTree( set, q, length * 2 / 3, std::max( 1, radius - 1 ), depth - 1 );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking parallel thinning of VoxelComplex" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = argc > 1 ? atoi( argv[ 1 ] ) : 64;
+  const unsigned int maxThreads = argc > 2 ? (unsigned int) atoi( argv[ 2 ] )
+    : std::max( 1u, std::thread::hardware_concurrency() );
+  Domain domain( Point::diagonal( 0 ), Point::diagonal( size - 1 ) );
+  DigitalSet set( domain );
+  tubeTree( set, Point( size / 2, size / 2, 0 ), size / 2, std::max( 2, size / 16 ), 3 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Complex vc( K );
+  vc.construct( set, functions::loadTable( simplicity::tableSimple26_6 ) );
+  const std::size_t nbVoxels = vc.nbCells( 3 );
+  trace.info() << "Input: " << nbVoxels << " voxels" << std::endl;
+
+  auto table = *functions::loadTable( isthmusicity::tableIsthmus );
+  auto pointToMaskMap =
+    *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  auto skelWithTableIsthmus =
+    [&table, &pointToMaskMap]( const Complex & fc, const Complex::Cell & c ) {
+      return functions::skelWithTable( table, pointToMaskMap, fc, c );
+    };
+
+  bool res = true;
+  std::size_t nbSkel = 0;
+  for ( unsigned int n = 1; n <= maxThreads; n *= 2 )
+    {
+      ThreadPool pool( n );
+      Clock c;
+      c.startClock();
+      Complex skel = functions::asymetricThinningScheme< Complex >
+        ( vc, functions::selectFirst< Complex >, skelWithTableIsthmus,
+          false, &pool );
+      const double t = c.stopClock();
+      trace.info() << n << " thread(s): " << skel.nbCells( 3 ) << " skeleton voxels in "
+                   << t << " ms, " << ( 1000.0 * nbVoxels / t ) << " voxels/s"
+                   << std::endl;
+      if ( n == 1 ) nbSkel = skel.nbCells( 3 );
+      res = res && ( skel.nbCells( 3 ) == nbSkel );
+    }
+
+  Clock c;
+  c.startClock();
+  std::vector< Complex::Cell > removed;
+  Complex skel = functions::borderQueueThinningScheme< Complex >
+    ( vc, skelWithTableIsthmus, std::back_inserter( removed ) );
+  const double t = c.stopClock();
+  trace.info() << "Border queue: " << skel.nbCells( 3 ) << " skeleton voxels, "
+               << removed.size() << " removed in " << t << " ms, "
+               << ( 1000.0 * removed.size() / t ) << " removed voxels/s"
+               << std::endl;
+  res = res && ( skel.nbCells( 3 ) + removed.size() == nbVoxels );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -1055,6 +1055,87 @@ TEST_CASE_METHOD(Fixture_X, "X Thin with Isthmus, and tables",
     }
 }
 
+TEST_CASE_METHOD(Fixture_X, "X Thin with a ThreadPool",
+                 "[x][isthmus][thin][function][table][parallel]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    vc.setSimplicityTable(
+        functions::loadTable(simplicity::tableSimple26_6));
+    auto table = *functions::loadTable(isthmusicity::tableIsthmus);
+    auto pointToMaskMap =
+        *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+    auto skelWithTableIsthmus =
+        [&table, &pointToMaskMap](const FixtureComplex &fc,
+                                  const FixtureComplex::Cell &c) {
+            return skelWithTable(table, pointToMaskMap, fc, c);
+        };
+    ThreadPool pool(4);
+
+    SECTION("Critical cliques are the same as the sequential ones") {
+        for (Dimension d = 0; d <= 3; ++d) {
+            auto seq = vc.criticalCliquesForD(d, vc);
+            auto par = vc.criticalCliquesForD(d, vc, pool);
+            REQUIRE(seq.size() == par.size());
+            for (std::size_t i = 0; i != seq.size(); ++i)
+                CHECK(seq[i] == par[i]);
+        }
+    }
+    SECTION("asymetricThinningScheme gives the sequential skeleton") {
+        auto vc_seq = asymetricThinningScheme<FixtureComplex>(
+            vc, selectFirst<FixtureComplex>, skelWithTableIsthmus);
+        auto vc_par = asymetricThinningScheme<FixtureComplex>(
+            vc, selectFirst<FixtureComplex>, skelWithTableIsthmus, false,
+            &pool);
+        REQUIRE(vc_seq.nbCells(3) == vc_par.nbCells(3));
+        CHECK(vc_seq == vc_par);
+    }
+    SECTION("persistenceAsymetricThinningScheme gives the sequential skeleton") {
+        auto vc_seq = persistenceAsymetricThinningScheme<FixtureComplex>(
+            vc, selectFirst<FixtureComplex>, skelWithTableIsthmus, 2);
+        auto vc_par = persistenceAsymetricThinningScheme<FixtureComplex>(
+            vc, selectFirst<FixtureComplex>, skelWithTableIsthmus, 2, false,
+            &pool);
+        REQUIRE(vc_seq.nbCells(3) == vc_par.nbCells(3));
+        CHECK(vc_seq == vc_par);
+    }
+}
+
+TEST_CASE_METHOD(Fixture_X, "X Thin with a border queue",
+                 "[x][isthmus][thin][function][table][queue]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    vc.setSimplicityTable(
+        functions::loadTable(simplicity::tableSimple26_6));
+    const auto nb_voxels = vc.nbCells(3);
+    std::vector<FixtureComplex::Cell> removed;
+
+    SECTION("with skelUltimate") {
+        auto vc_new = borderQueueThinningScheme<FixtureComplex>(
+            vc, skelUltimate<FixtureComplex>, std::back_inserter(removed));
+        CHECK(vc_new.nbCells(3) == 1);
+        CHECK(removed.size() + 1 == nb_voxels);
+        CHECK(vc_new.euler() == 1);
+    }
+    SECTION("with skelWithTable (isIsthmus)") {
+        auto table = *functions::loadTable(isthmusicity::tableIsthmus);
+        auto pointToMaskMap =
+            *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+        auto skelWithTableIsthmus =
+            [&table, &pointToMaskMap](const FixtureComplex &fc,
+                                      const FixtureComplex::Cell &c) {
+                return skelWithTable(table, pointToMaskMap, fc, c);
+            };
+        auto vc_new = borderQueueThinningScheme<FixtureComplex>(
+            vc, skelWithTableIsthmus, std::back_inserter(removed));
+        CHECK(vc_new.nbCells(3) > 1);
+        CHECK(vc_new.nbCells(3) + removed.size() == nb_voxels);
+        CHECK(vc_new.euler() == vc.euler());
+        // Removed voxels are not in the skeleton.
+        for (const auto &voxel : removed)
+            CHECK(vc_new.findCell(3, voxel) == vc_new.end(3));
+    }
+}
+
 /// Use distance map in the Select function.
 TEST_CASE_METHOD(Fixture_X, "X DistanceMap", "[x][distance][thin]") {
     using namespace DGtal::functions;